@@ -0,0 +1,261 @@
+/*
+  Shared helpers for the SEAL / OpenFHE benchmarks:
+  repetition statistics and hardware counters via perf_event_open (Linux only)
+ */
+
+#ifndef HE_BENCH_UTIL_H
+#define HE_BENCH_UTIL_H
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+namespace bench {
+
+// ------------------------------- PerfCounters
+// cycles, instructions, cache-misses를 하나의 그룹으로 측정.
+// perf_event_paranoid 설정 등으로 열 수 없으면 available() == false이고 값은 0
+// 호출한 스레드만 측정 (inherit 없음). 다른 스레드(OpenMP worker 등)에서 실행된 연산은 포함되지 않음
+class PerfCounters {
+public:
+    struct Sample {
+        uint64_t cycles       = 0;
+        uint64_t instructions = 0;
+        uint64_t cacheMisses  = 0;
+    };
+
+private:
+    int fds[3] = {-1, -1, -1};
+
+#ifdef __linux__
+    static int openCounter(uint64_t config, int groupFd) {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.type           = PERF_TYPE_HARDWARE;
+        attr.size           = sizeof(attr);
+        attr.config         = config;
+        attr.disabled       = groupFd == -1 ? 1 : 0;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv     = 1;
+        attr.read_format    = PERF_FORMAT_GROUP;
+        return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, groupFd, 0));
+    }
+#endif
+
+public:
+    PerfCounters() {
+#ifdef __linux__
+        fds[0] = openCounter(PERF_COUNT_HW_CPU_CYCLES, -1);
+        if (fds[0] != -1) {
+            fds[1] = openCounter(PERF_COUNT_HW_INSTRUCTIONS, fds[0]);
+            fds[2] = openCounter(PERF_COUNT_HW_CACHE_MISSES, fds[0]);
+        }
+        if (fds[1] == -1 || fds[2] == -1)
+            close();
+#endif
+    }
+
+    ~PerfCounters() {
+        close();
+    }
+
+    PerfCounters(const PerfCounters&)            = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    bool available() const {
+        return fds[0] != -1;
+    }
+
+    void start() {
+#ifdef __linux__
+        if (!available())
+            return;
+        ioctl(fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ioctl(fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+#endif
+    }
+
+    Sample stop() {
+        Sample s;
+#ifdef __linux__
+        if (!available())
+            return s;
+        ioctl(fds[0], PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+        uint64_t buf[4] = {0, 0, 0, 0};  // nr, cycles, instructions, cache-misses
+        if (read(fds[0], buf, sizeof(buf)) == static_cast<ssize_t>(sizeof(buf)) && buf[0] == 3) {
+            s.cycles       = buf[1];
+            s.instructions = buf[2];
+            s.cacheMisses  = buf[3];
+        }
+#endif
+        return s;
+    }
+
+private:
+    void close() {
+#ifdef __linux__
+        for (int& fd : fds) {
+            if (fd != -1)
+                ::close(fd);
+            fd = -1;
+        }
+#endif
+    }
+};
+
+// ------------------------------- BenchResult
+struct BenchResult {
+    std::string backend;
+    std::string op;
+    uint32_t logN  = 0;
+    uint32_t level = 0;
+    size_t reps    = 0;
+    double meanUs = 0, stddevUs = 0, minUs = 0, medianUs = 0, p95Us = 0, maxUs = 0;
+    bool hasCounters      = false;
+    double cyclesPerOp    = 0;      // 반복 평균
+    double instrPerOp     = 0;
+    double cacheMissPerOp = 0;
+};
+
+inline BenchResult summarize(std::vector<double> samplesUs) {
+    BenchResult r;
+    r.reps = samplesUs.size();
+    if (samplesUs.empty())
+        return r;
+    std::sort(samplesUs.begin(), samplesUs.end());
+    double sum = 0;
+    for (double v : samplesUs)
+        sum += v;
+    r.meanUs = sum / samplesUs.size();
+    double var = 0;
+    for (double v : samplesUs)
+        var += (v - r.meanUs) * (v - r.meanUs);
+    r.stddevUs = samplesUs.size() > 1 ? std::sqrt(var / (samplesUs.size() - 1)) : 0;
+    r.minUs    = samplesUs.front();
+    r.maxUs    = samplesUs.back();
+    r.medianUs = samplesUs[samplesUs.size() / 2];
+    r.p95Us    = samplesUs[std::min(samplesUs.size() - 1, static_cast<size_t>(0.95 * samplesUs.size()))];
+    return r;
+}
+
+// ------------------------------- Runner
+// setup은 측정에서 제외되고 매 반복 전에 호출됨 (in-place 연산의 입력 복원 등). fn 한 번 = 연산 한 번
+class Runner {
+private:
+    PerfCounters counters;
+    std::vector<BenchResult> results;
+    size_t reps;
+    size_t warmup;
+
+public:
+    explicit Runner(size_t reps = 10, size_t warmup = 2) : reps(reps), warmup(warmup) {}
+
+    bool countersAvailable() const {
+        return counters.available();
+    }
+
+    const std::vector<BenchResult>& getResults() const {
+        return results;
+    }
+
+    const BenchResult& run(const std::string& backend, const std::string& op, uint32_t logN, uint32_t level,
+                           const std::function<void()>& fn, const std::function<void()>& setup = nullptr) {
+        using Clock = std::chrono::steady_clock;
+        for (size_t i = 0; i < warmup; ++i) {
+            if (setup)
+                setup();
+            fn();
+        }
+        std::vector<double> samples;
+        samples.reserve(reps);
+        PerfCounters::Sample total;
+        for (size_t i = 0; i < reps; ++i) {
+            if (setup)
+                setup();
+            counters.start();
+            Clock::time_point t0 = Clock::now();
+            fn();
+            Clock::time_point t1   = Clock::now();
+            PerfCounters::Sample s = counters.stop();
+            samples.push_back(std::chrono::duration<double, std::micro>(t1 - t0).count());
+            total.cycles += s.cycles;
+            total.instructions += s.instructions;
+            total.cacheMisses += s.cacheMisses;
+        }
+        BenchResult r    = summarize(std::move(samples));
+        r.backend        = backend;
+        r.op             = op;
+        r.logN           = logN;
+        r.level          = level;
+        r.hasCounters    = counters.available();
+        r.cyclesPerOp    = reps ? static_cast<double>(total.cycles) / reps : 0;
+        r.instrPerOp     = reps ? static_cast<double>(total.instructions) / reps : 0;
+        r.cacheMissPerOp = reps ? static_cast<double>(total.cacheMisses) / reps : 0;
+        results.push_back(r);
+        print(results.back());
+        return results.back();
+    }
+
+    static void printHeader(std::ostream& out = std::cout) {
+        out << std::left << std::setw(8) << "backend" << std::setw(14) << "op" << std::right << std::setw(5) << "logN"
+            << std::setw(6) << "level" << std::setw(12) << "mean(us)" << std::setw(10) << "stddev" << std::setw(12)
+            << "median" << std::setw(12) << "p95" << std::setw(14) << "cycles" << std::setw(14) << "instr"
+            << std::setw(8) << "IPC" << std::setw(12) << "cache-miss" << std::endl;
+    }
+
+    static void print(const BenchResult& r, std::ostream& out = std::cout) {
+        out << std::left << std::setw(8) << r.backend << std::setw(14) << r.op << std::right << std::setw(5) << r.logN
+            << std::setw(6) << r.level << std::fixed << std::setprecision(1) << std::setw(12) << r.meanUs
+            << std::setw(10) << r.stddevUs << std::setw(12) << r.medianUs << std::setw(12) << r.p95Us;
+        if (r.hasCounters) {
+            out << std::setw(14) << std::setprecision(0) << r.cyclesPerOp << std::setw(14) << r.instrPerOp
+                << std::setw(8) << std::setprecision(2) << (r.cyclesPerOp > 0 ? r.instrPerOp / r.cyclesPerOp : 0)
+                << std::setw(12) << std::setprecision(0) << r.cacheMissPerOp;
+        }
+        else {
+            out << std::setw(14) << "n/a" << std::setw(14) << "n/a" << std::setw(8) << "n/a" << std::setw(12) << "n/a";
+        }
+        out << std::defaultfloat << std::endl;
+    }
+
+    void writeCsv(const std::string& path) const {
+        std::ofstream out(path);
+        out << "backend,op,logN,level,reps,mean_us,stddev_us,min_us,median_us,p95_us,max_us,cycles,instructions,"
+               "cache_misses\n";
+        for (const auto& r : results) {
+            out << r.backend << "," << r.op << "," << r.logN << "," << r.level << "," << r.reps << "," << r.meanUs
+                << "," << r.stddevUs << "," << r.minUs << "," << r.medianUs << "," << r.p95Us << "," << r.maxUs << ",";
+            if (r.hasCounters)
+                out << r.cyclesPerOp << "," << r.instrPerOp << "," << r.cacheMissPerOp << "\n";
+            else
+                out << ",,\n";
+        }
+    }
+};
+
+// "13-16" 또는 "14" 형태의 범위 인자
+inline std::pair<uint32_t, uint32_t> parseRange(const std::string& arg) {
+    size_t dash = arg.find('-');
+    if (dash == std::string::npos)
+        return {std::stoul(arg), std::stoul(arg)};
+    return {std::stoul(arg.substr(0, dash)), std::stoul(arg.substr(dash + 1))};
+}
+
+}  // namespace bench
+
+#endif
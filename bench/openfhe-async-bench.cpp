@@ -0,0 +1,140 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Async branch execution (async-ciphertext.h)
+  y = sum_i (x+i)^2 * (x^2+i), i = 1..branches. 가지끼리는 독립이고 합은 이진 트리로 더함
+  - sequential: TraceableCiphertext를 한 스레드에서 순서대로 호출
+  - async: AsyncTraceCircuit이 준비된 연산부터 worker에서 병렬 실행
+  회로 하나의 latency, 동시에 실행된 연산 수의 최댓값, 정밀도(모든 슬롯) 출력
+ */
+
+#include "openfhe.h"
+#include "traceable-ciphertext.h"
+#include "async-ciphertext.h"
+#include "bench-util.h"
+
+#include <random>
+
+using namespace lbcrypto;
+
+// 항들을 이진 트리로 더함. add(a, b)는 결과를 반환
+template <typename T, typename Add>
+static T SumTree(std::vector<T> terms, Add add) {
+    while (terms.size() > 1) {
+        std::vector<T> next;
+        for (size_t i = 0; i + 1 < terms.size(); i += 2)
+            next.push_back(add(terms[i], terms[i + 1]));
+        if (terms.size() % 2)
+            next.push_back(terms.back());
+        terms = std::move(next);
+    }
+    return terms[0];
+}
+
+static TraceableCiphertext<DCRTPoly> Sequential(const TraceableCiphertext<DCRTPoly>& x, size_t branches) {
+    auto x2 = x.cipherSquare();
+    std::vector<TraceableCiphertext<DCRTPoly>> terms;
+    for (size_t i = 1; i <= branches; ++i) {
+        const double c = static_cast<double>(i);
+        terms.push_back(x.cipherAdd(c).cipherSquare().cipherMult(x2.cipherAdd(c)));
+    }
+    return SumTree(std::move(terms), [](const auto& a, const auto& b) { return a.cipherAdd(b); });
+}
+
+static AsyncCiphertext<OpenFHETraceBackend<DCRTPoly>> Async(AsyncTraceCircuit<OpenFHETraceBackend<DCRTPoly>>& circuit, const TraceableCiphertext<DCRTPoly>& x,
+                                       size_t branches) {
+    auto ax = circuit.input(x);
+    auto x2 = ax.cipherSquare();
+    std::vector<AsyncCiphertext<OpenFHETraceBackend<DCRTPoly>>> terms;
+    for (size_t i = 1; i <= branches; ++i) {
+        const double c = static_cast<double>(i);
+        terms.push_back(ax.cipherAdd(c).cipherSquare().cipherMult(x2.cipherAdd(c)));
+    }
+    return SumTree(std::move(terms), [](const auto& a, const auto& b) { return a.cipherAdd(b); });
+}
+
+// 사용법: openfhe-async-bench [--branches 8] [--workers 0(코어 수)] [--reps 10]
+int main(int argc, char* argv[]) {
+    size_t maxBranches = 8, workers = 0, reps = 10;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--branches" && i + 1 < argc)
+            maxBranches = std::stoul(argv[++i]);
+        else if (arg == "--workers" && i + 1 < argc)
+            workers = std::stoul(argv[++i]);
+        else if (arg == "--reps" && i + 1 < argc)
+            reps = std::stoul(argv[++i]);
+    }
+    if (workers == 0)
+        workers = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+
+    CCParams<CryptoContextCKKSRNS> parameters;
+    parameters.SetMultiplicativeDepth(3);   // (x+i)^2 * (x^2+i): 2, 여유 1
+    parameters.SetScalingModSize(50);
+    parameters.SetScalingTechnique(FLEXIBLEAUTO);
+    parameters.SetRingDim(16384);
+    CryptoContext<DCRTPoly> cc = GenCryptoContext(parameters);
+    cc->Enable(PKE);
+    cc->Enable(KEYSWITCH);
+    cc->Enable(LEVELEDSHE);
+    auto keys = cc->KeyGen();
+    cc->EvalMultKeyGen(keys.secretKey);
+
+    const uint32_t slots = cc->GetRingDimension() / 2;
+    std::vector<std::complex<double>> input(slots);
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    for (auto& v : input)
+        v = dist(rng);
+    TracePolicy off;
+    off.mode = TRACE_OFF;
+    auto backend = std::make_shared<OpenFHETraceBackend<DCRTPoly>>(cc, keys);
+    TraceableCiphertext<DCRTPoly> x(backend, input, off);
+
+    std::cout << workers << " workers" << std::endl;
+    bench::Runner runner(reps);
+    bench::Runner::printHeader();
+    for (size_t branches = 1; branches <= maxBranches; branches *= 2) {
+        const std::string suffix = "-b" + std::to_string(branches);
+        const double sequentialUs =
+            runner.run("OpenFHE", "seq" + suffix, 14, 0, [&]() { Sequential(x, branches); }).medianUs;
+
+        AsyncTraceCircuit<OpenFHETraceBackend<DCRTPoly>> circuit(workers);
+        const double asyncUs =
+            runner.run("OpenFHE", "async" + suffix, 14, 0, [&]() { Async(circuit, x, branches).wait(); }).medianUs;
+        PrecisionReport report = Async(circuit, x, branches).get().analyzePrecision("async" + suffix);
+        std::cout << "    + speedup " << std::fixed << std::setprecision(2) << sequentialUs / asyncUs
+                  << "x, max parallel ops " << circuit.getMaxParallelism() << ", " << std::setprecision(1)
+                  << report.precisionBits << " bits" << std::defaultfloat << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,124 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Batch evaluation throughput (OpenFHE)
+  (x+1)^2(x^2+2) 회로를 여러 암호문에 BatchExecutor(task5)로 적용하고, worker 수 1 ~ 전체 코어에 대해
+  - managed: worker당 OpenMP 스레드 = 코어 수 / worker 수
+  - oversubscribed: worker마다 OpenMP 스레드 = 코어 수
+  처리량(records/s)과 speedup 비교
+ */
+
+#include "openfhe.h"
+#include "openfhe-batch-executor.h"
+#include "bench-util.h"
+
+#include <random>
+
+using namespace lbcrypto;
+
+// 사용법: openfhe-batch-bench [--records 1024] [--reps 3]
+int main(int argc, char* argv[]) {
+    size_t records = 1024;
+    size_t reps    = 3;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--records" && i + 1 < argc)
+            records = std::stoul(argv[++i]);
+        else if (arg == "--reps" && i + 1 < argc)
+            reps = std::stoul(argv[++i]);
+    }
+
+    CCParams<CryptoContextCKKSRNS> parameters;
+    parameters.SetMultiplicativeDepth(2);
+    parameters.SetScalingModSize(50);
+    parameters.SetScalingTechnique(FLEXIBLEAUTO);
+
+    CryptoContext<DCRTPoly> cc = GenCryptoContext(parameters);
+    cc->Enable(PKE);
+    cc->Enable(KEYSWITCH);
+    cc->Enable(LEVELEDSHE);
+
+    auto keys = cc->KeyGen();
+    cc->EvalMultKeyGen(keys.secretKey);
+
+    std::cout << "Encrypting " << records << " records (ring dimension " << cc->GetRingDimension() << ")"
+              << std::endl;
+    std::vector<double> x(cc->GetRingDimension() / 2);
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    std::vector<Ciphertext<DCRTPoly>> inputs(records);
+    for (auto& c : inputs) {
+        for (auto& v : x)
+            v = dist(rng);
+        c = cc->Encrypt(keys.publicKey, cc->MakeCKKSPackedPlaintext(x));
+    }
+
+    auto circuit = [&](const Ciphertext<DCRTPoly>& c) {
+        auto c1 = cc->EvalAdd(c, 1.0);
+        auto c2 = cc->EvalAdd(cc->EvalSquare(c), 2.0);
+        return cc->EvalMult(cc->EvalSquare(c1), c2);
+    };
+
+    size_t cores = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+    std::vector<size_t> workerCounts;
+    for (size_t w = 1; w < cores; w *= 2)
+        workerCounts.push_back(w);
+    workerCounts.push_back(cores);
+
+    std::cout << std::setw(8) << "workers" << std::setw(16) << "mode" << std::setw(6) << "omp" << std::setw(12)
+              << "median(s)" << std::setw(14) << "records/s" << std::setw(10) << "speedup" << std::endl;
+    double base = 0;
+    for (size_t workers : workerCounts) {
+        for (bool oversubscribe : {false, true}) {
+            if (oversubscribe && workers == 1)
+                continue;
+            BatchExecutor<DCRTPoly> executor(workers, oversubscribe ? static_cast<uint32_t>(cores) : 0);
+            std::vector<double> samples;
+            TimeVar t;
+            for (size_t r = 0; r < reps; ++r) {
+                TIC(t);
+                auto outputs = executor.run(inputs, circuit);
+                samples.push_back(TOC(t) / 1000);
+            }
+            double seconds    = bench::summarize(samples).medianUs;
+            double throughput = records / seconds;
+            if (base == 0)
+                base = throughput;
+            std::cout << std::setw(8) << workers << std::setw(16) << (oversubscribe ? "oversubscribed" : "managed")
+                      << std::setw(6) << executor.getOmpThreadsPerWorker() << std::fixed << std::setprecision(3)
+                      << std::setw(12) << seconds << std::setprecision(1) << std::setw(14) << throughput
+                      << std::setprecision(2) << std::setw(9) << throughput / base << "x" << std::defaultfloat
+                      << std::endl;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,145 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Ciphertext container benchmark (OpenFHE)
+  암호문 N개를 압축 없음 / zstd, shadow(original vector) 포함 여부 조합으로 저장하고 불러와서
+  암호문당 크기, 저장/불러오기 처리량(GB/s), 임의 위치 record 1개 불러오기 지연시간 출력
+ */
+
+#include "openfhe.h"
+#include "openfhe-container.h"
+#include "bench-util.h"
+
+#include <cstdio>
+#include <random>
+
+using namespace lbcrypto;
+
+// 사용법: openfhe-container-bench [--count 256] [--reps 3] [--path /tmp/openfhe.ckct]
+int main(int argc, char* argv[]) {
+    size_t count     = 256;
+    size_t reps      = 3;
+    std::string path = "openfhe-bench.ckct";
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--count" && i + 1 < argc)
+            count = std::stoul(argv[++i]);
+        else if (arg == "--reps" && i + 1 < argc)
+            reps = std::stoul(argv[++i]);
+        else if (arg == "--path" && i + 1 < argc)
+            path = argv[++i];
+    }
+
+    CCParams<CryptoContextCKKSRNS> parameters;
+    parameters.SetMultiplicativeDepth(4);
+    parameters.SetScalingModSize(50);
+    parameters.SetScalingTechnique(FLEXIBLEAUTO);
+
+    CryptoContext<DCRTPoly> cc = GenCryptoContext(parameters);
+    cc->Enable(PKE);
+    cc->Enable(KEYSWITCH);
+    cc->Enable(LEVELEDSHE);
+    auto keys = cc->KeyGen();
+
+    std::vector<std::complex<double>> x(cc->GetRingDimension() / 2);
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    for (auto& v : x)
+        v = dist(rng);
+    auto c = cc->Encrypt(keys.publicKey, cc->MakeCKKSPackedPlaintext(x));
+
+    TracePolicy policy;
+    policy.mode = TRACE_OFF;
+    auto backend = std::make_shared<OpenFHETraceBackend<DCRTPoly>>(cc, keys);
+    std::vector<TraceableCiphertext<DCRTPoly>> traced;
+    for (size_t i = 0; i < count; ++i)
+        traced.emplace_back(backend, x, c, policy);
+
+    auto seconds = [](std::chrono::steady_clock::time_point start) {
+        return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    };
+
+    std::cout << count << " ciphertexts, ring dimension " << cc->GetRingDimension() << std::endl;
+    std::cout << std::setw(8) << "shadow" << std::setw(6) << "zstd" << std::setw(14) << "bytes/ct" << std::setw(12)
+              << "save GB/s" << std::setw(12) << "load GB/s" << std::setw(16) << "random load(us)" << std::endl;
+
+    for (bool withShadow : {false, true}) {
+        for (int level : {0, 3}) {
+            if (level > 0 && !CiphertextContainer::zstdAvailable())
+                continue;
+            std::vector<double> saveS, loadS, randomUs;
+            size_t fileSize = 0;
+            for (size_t r = 0; r < reps; ++r) {
+                auto start = std::chrono::steady_clock::now();
+                {
+                    ContainerWriter writer(path, CONTAINER_OPENFHE, level);
+                    for (const auto& tc : traced) {
+                        if (withShadow)
+                            appendTraceable(writer, tc);
+                        else
+                            appendCiphertext(writer, tc.getCiphertext());
+                    }
+                }
+                saveS.push_back(seconds(start));
+
+                start = std::chrono::steady_clock::now();
+                ContainerReader reader(path);
+                for (size_t i = 0; i < reader.size(); ++i) {
+                    if (withShadow)
+                        loadTraceable(reader, i, backend, policy);
+                    else {
+                        std::vector<char> scratch;
+                        loadCiphertext<DCRTPoly>(reader, i, scratch);
+                    }
+                }
+                loadS.push_back(seconds(start));
+                fileSize = reader.getFileSize();
+
+                std::uniform_int_distribution<size_t> pick(0, count - 1);
+                std::vector<char> scratch;
+                for (int k = 0; k < 16; ++k) {
+                    start = std::chrono::steady_clock::now();
+                    loadCiphertext<DCRTPoly>(reader, pick(rng), scratch);
+                    randomUs.push_back(seconds(start) * 1e6);
+                }
+            }
+            double gb = fileSize / 1e9;
+            std::cout << std::setw(8) << (withShadow ? "yes" : "no") << std::setw(6) << level << std::setw(14)
+                      << fileSize / count << std::fixed << std::setprecision(2) << std::setw(12)
+                      << gb / bench::summarize(saveS).medianUs << std::setw(12)
+                      << gb / bench::summarize(loadS).medianUs << std::setprecision(1) << std::setw(16)
+                      << bench::summarize(randomUs).medianUs << std::defaultfloat << std::endl;
+        }
+    }
+    std::remove(path.c_str());
+    return 0;
+}
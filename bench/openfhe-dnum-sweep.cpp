@@ -0,0 +1,222 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Hybrid key-switching digit(dnum) sweep for OpenFHE CKKS
+  NumLargeDigits, ScalingTechnique, depth 조합마다 context를 새로 생성해서
+  rotation/relinearization 소요 시간, eval key 메모리, keygen 시간을 비교
+ */
+
+#include "openfhe.h"
+#include "cryptocontext-ser.h"
+#include "key/key-ser.h"
+#include "scheme/ckksrns/ckksrns-ser.h"
+#include "bench-util.h"
+
+#include <fstream>
+#include <random>
+#include <sstream>
+
+using namespace lbcrypto;
+
+struct SweepResult {
+    std::string scalTech;
+    uint32_t depth   = 0;
+    uint32_t dnum    = 0;
+    uint32_t ringDim = 0;
+    size_t towers    = 0;
+    double multKeyGenMs = 0, rotKeyGenMs = 0;
+    size_t multKeyBytes = 0, rotKeyBytes = 0;
+    bench::BenchResult rotate, relin;
+};
+
+std::string ScalTechName(ScalingTechnique scalTech) {
+    switch (scalTech) {
+        case FLEXIBLEAUTO:
+            return "FLEXIBLEAUTO";
+        case FIXEDAUTO:
+            return "FIXEDAUTO";
+        case FIXEDMANUAL:
+            return "FIXEDMANUAL";
+        default:
+            return "OTHER";
+    }
+}
+
+// "1,2,3" 또는 "1-4" 형태의 인자
+std::vector<uint32_t> ParseList(const std::string& arg) {
+    std::vector<uint32_t> values;
+    if (arg.find('-') != std::string::npos) {
+        auto range = bench::parseRange(arg);
+        for (uint32_t v = range.first; v <= range.second; ++v)
+            values.push_back(v);
+        return values;
+    }
+    std::stringstream ss(arg);
+    std::string item;
+    while (std::getline(ss, item, ','))
+        values.push_back(std::stoul(item));
+    return values;
+}
+
+bool RunConfig(ScalingTechnique scalTech, uint32_t depth, uint32_t dnum, uint32_t ringDim, size_t reps,
+               SweepResult& r) {
+    CCParams<CryptoContextCKKSRNS> parameters;
+    parameters.SetMultiplicativeDepth(depth);
+    parameters.SetScalingModSize(50);
+    parameters.SetScalingTechnique(scalTech);
+    parameters.SetKeySwitchTechnique(HYBRID);
+    parameters.SetNumLargeDigits(dnum);     // 반드시 GenCryptoContext 이전에 설정
+    if (ringDim)
+        parameters.SetRingDim(ringDim);
+
+    CryptoContext<DCRTPoly> cc;
+    try {
+        cc = GenCryptoContext(parameters);
+    }
+    catch (const std::exception& e) {
+        std::cout << ScalTechName(scalTech) << " depth=" << depth << " dnum=" << dnum << ": " << e.what() << std::endl;
+        return false;
+    }
+    cc->Enable(PKE);
+    cc->Enable(KEYSWITCH);
+    cc->Enable(LEVELEDSHE);
+
+    r.scalTech = ScalTechName(scalTech);
+    r.depth    = depth;
+    r.dnum     = dnum;
+    r.ringDim  = cc->GetRingDimension();
+    r.towers   = cc->GetElementParams()->GetParams().size();
+
+    auto keys = cc->KeyGen();
+    TimeVar t;
+    TIC(t);
+    cc->EvalMultKeyGen(keys.secretKey);
+    r.multKeyGenMs = TOC(t);
+    TIC(t);
+    cc->EvalRotateKeyGen(keys.secretKey, {2});
+    r.rotKeyGenMs = TOC(t);
+
+    // eval key 메모리는 직렬화한 크기로 측정 (이 context의 키만)
+    const std::string keyTag = keys.secretKey->GetKeyTag();
+    std::stringstream multKeyStream, rotKeyStream;
+    cc->SerializeEvalMultKey(multKeyStream, SerType::BINARY, keyTag);
+    cc->SerializeEvalAutomorphismKey(rotKeyStream, SerType::BINARY, keyTag);
+    r.multKeyBytes = multKeyStream.str().size();
+    r.rotKeyBytes  = rotKeyStream.str().size();
+
+    std::vector<double> x(8);
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    for (auto& v : x)
+        v = dist(rng);
+    auto c1 = cc->Encrypt(keys.publicKey, cc->MakeCKKSPackedPlaintext(x));
+    auto c2 = cc->Encrypt(keys.publicKey, cc->MakeCKKSPackedPlaintext(x));
+    auto c3 = cc->EvalMultNoRelin(c1, c2);
+
+    std::vector<double> rotSamples, relinSamples;
+    Ciphertext<DCRTPoly> out;
+    for (size_t i = 0; i < reps; ++i) {
+        TIC(t);
+        out = cc->EvalRotate(c1, 2);
+        rotSamples.push_back(TOC(t) * 1000);
+        TIC(t);
+        out = cc->Relinearize(c3);
+        relinSamples.push_back(TOC(t) * 1000);
+    }
+    r.rotate = bench::summarize(rotSamples);
+    r.relin  = bench::summarize(relinSamples);
+
+    // eval key는 전역 저장소에 남으므로 다음 설정 전에 제거
+    cc->ClearEvalMultKeys();
+    cc->ClearEvalAutomorphismKeys();
+    return true;
+}
+
+void PrintResult(const SweepResult& r) {
+    std::cout << std::left << std::setw(14) << r.scalTech << std::right << std::setw(6) << r.depth << std::setw(5)
+              << r.dnum << std::setw(8) << r.ringDim << std::setw(7) << r.towers << std::fixed << std::setprecision(1)
+              << std::setw(12) << r.rotate.medianUs << std::setw(12) << r.relin.medianUs << std::setw(12)
+              << r.rotKeyBytes / (1024.0 * 1024.0) << std::setw(12) << r.multKeyBytes / (1024.0 * 1024.0)
+              << std::setw(12) << r.rotKeyGenMs << std::setw(12) << r.multKeyGenMs << std::defaultfloat << std::endl;
+}
+
+// 사용법: openfhe-dnum-sweep [--dnum 1-4] [--depth 3,5,10] [--ringdim 0] [--reps 10] [--csv out.csv]
+int main(int argc, char* argv[]) {
+    std::vector<uint32_t> dnums  = {1, 2, 3, 4};
+    std::vector<uint32_t> depths = {3, 5, 10};
+    uint32_t ringDim             = 0;   // 0: 보안 조건에 맞게 OpenFHE가 선택
+    size_t reps                  = 10;
+    std::string csvPath;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--dnum" && i + 1 < argc)
+            dnums = ParseList(argv[++i]);
+        else if (arg == "--depth" && i + 1 < argc)
+            depths = ParseList(argv[++i]);
+        else if (arg == "--ringdim" && i + 1 < argc)
+            ringDim = std::stoul(argv[++i]);
+        else if (arg == "--reps" && i + 1 < argc)
+            reps = std::stoul(argv[++i]);
+        else if (arg == "--csv" && i + 1 < argc)
+            csvPath = argv[++i];
+    }
+
+    std::cout << std::left << std::setw(14) << "scalTech" << std::right << std::setw(6) << "depth" << std::setw(5)
+              << "dnum" << std::setw(8) << "N" << std::setw(7) << "towers" << std::setw(12) << "rotate(us)"
+              << std::setw(12) << "relin(us)" << std::setw(12) << "rotKey(MB)" << std::setw(12) << "multKey(MB)"
+              << std::setw(12) << "rotKG(ms)" << std::setw(12) << "multKG(ms)" << std::endl;
+
+    std::vector<SweepResult> results;
+    for (ScalingTechnique scalTech : {FLEXIBLEAUTO, FIXEDAUTO, FIXEDMANUAL}) {
+        for (uint32_t depth : depths) {
+            for (uint32_t dnum : dnums) {
+                SweepResult r;
+                if (RunConfig(scalTech, depth, dnum, ringDim, reps, r)) {
+                    PrintResult(r);
+                    results.push_back(r);
+                }
+            }
+        }
+    }
+
+    if (!csvPath.empty()) {
+        std::ofstream out(csvPath);
+        out << "scal_tech,depth,dnum,ring_dim,towers,rotate_median_us,rotate_p95_us,relin_median_us,relin_p95_us,"
+               "rot_key_bytes,mult_key_bytes,rot_keygen_ms,mult_keygen_ms\n";
+        for (const auto& r : results) {
+            out << r.scalTech << "," << r.depth << "," << r.dnum << "," << r.ringDim << "," << r.towers << ","
+                << r.rotate.medianUs << "," << r.rotate.p95Us << "," << r.relin.medianUs << "," << r.relin.p95Us << ","
+                << r.rotKeyBytes << "," << r.multKeyBytes << "," << r.rotKeyGenMs << "," << r.multKeyGenMs << "\n";
+        }
+    }
+    return 0;
+}
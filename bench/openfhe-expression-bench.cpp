@@ -0,0 +1,118 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Lazy expression lowering vs eager TraceableCiphertext calls (traced-expression.h)
+  p(x) = 1 + 0.5x + 0.25x^2 + 0.125x^3 + 0.0625x^4 + 2 + 3
+  - eager: 항마다 cipherMult(상수) + cipherAdd, 상수도 하나씩 더함
+  - lazy: 상수는 하나로 합치고 네 항을 cipherLinearWSum(EvalLinearWSum) 한 번으로 계산
+  연산 수, 회로 latency, 소모 레벨, 정밀도(모든 슬롯) 출력
+ */
+
+#include "openfhe.h"
+#include "traceable-ciphertext.h"
+#include "traced-expression.h"
+#include "bench-util.h"
+
+#include <random>
+
+using namespace lbcrypto;
+
+static TraceableCiphertext<DCRTPoly> Eager(const TraceableCiphertext<DCRTPoly>& x) {
+    auto x2 = x.cipherMult(x);
+    auto x3 = x2.cipherMult(x);
+    auto x4 = x2.cipherMult(x2);
+    auto y  = x.cipherMult(0.5).cipherAdd(1.0);
+    y += x2.cipherMult(0.25);
+    y += x3.cipherMult(0.125);
+    y += x4.cipherMult(0.0625);
+    y += 2.0;
+    y += 3.0;
+    return y;
+}
+
+static TraceableCiphertext<DCRTPoly> Lazy(const TraceableCiphertext<DCRTPoly>& x) {
+    auto e  = lazy(x);
+    auto e2 = e * e;
+    auto e3 = e2 * e;
+    auto e4 = e2 * e2;
+    return (1 + 0.5 * e + 0.25 * e2 + 0.125 * e3 + 0.0625 * e4 + 2 + 3).evaluate();
+}
+
+// 사용법: openfhe-expression-bench [--reps 10]
+int main(int argc, char* argv[]) {
+    size_t reps = 10;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--reps" && i + 1 < argc)
+            reps = std::stoul(argv[++i]);
+    }
+
+    CCParams<CryptoContextCKKSRNS> parameters;
+    parameters.SetMultiplicativeDepth(4);   // x^4: 2, 상수 곱 1, 여유 1
+    parameters.SetScalingModSize(50);
+    parameters.SetScalingTechnique(FLEXIBLEAUTO);
+    parameters.SetRingDim(16384);
+    CryptoContext<DCRTPoly> cc = GenCryptoContext(parameters);
+    cc->Enable(PKE);
+    cc->Enable(KEYSWITCH);
+    cc->Enable(LEVELEDSHE);
+    auto keys = cc->KeyGen();
+    cc->EvalMultKeyGen(keys.secretKey);
+
+    const uint32_t slots = cc->GetRingDimension() / 2;
+    std::vector<std::complex<double>> input(slots);
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    for (auto& v : input)
+        v = dist(rng);
+    TracePolicy off;
+    off.mode = TRACE_OFF;
+    auto backend = std::make_shared<OpenFHETraceBackend<DCRTPoly>>(cc, keys);
+    TraceableCiphertext<DCRTPoly> x(backend, input, off);
+
+    bench::Runner runner(reps);
+    bench::Runner::printHeader();
+    const std::pair<const char*, TraceableCiphertext<DCRTPoly> (*)(const TraceableCiphertext<DCRTPoly>&)> circuits[] = {
+        {"eager", Eager}, {"lazy", Lazy}};
+    for (const auto& circuit : circuits) {
+        uint64_t before                 = x.getOpCount();
+        TraceableCiphertext<DCRTPoly> y = circuit.second(x);
+        uint64_t ops                    = y.getOpCount() - before;
+        const auto& ct                  = y.getCiphertext();
+        uint32_t levels                 = static_cast<uint32_t>(ct->GetLevel() + ct->GetNoiseScaleDeg() - 1);
+        PrecisionReport report          = y.analyzePrecision(circuit.first);
+        runner.run("OpenFHE", circuit.first, 14, 0, [&]() { circuit.second(x); });
+        std::cout << "    + " << circuit.first << ": " << ops << " ops, " << levels << " levels, " << std::fixed
+                  << std::setprecision(1) << report.precisionBits << " bits" << std::defaultfloat << std::endl;
+    }
+    return 0;
+}
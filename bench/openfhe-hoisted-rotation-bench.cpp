@@ -0,0 +1,120 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Hoisted multi-rotation benchmark
+  같은 암호문을 k개의 index로 회전할 때 EvalRotate k번과
+  EvalFastRotationPrecompute 1번 + EvalFastRotation k번(TraceableCiphertext::cipherRotate)을 비교
+ */
+
+#include "openfhe.h"
+#include "traceable-ciphertext.h"
+#include "bench-util.h"
+
+#include <random>
+
+using namespace lbcrypto;
+
+// 사용법: openfhe-hoisted-rotation-bench [--kmax 32] [--reps 10]
+int main(int argc, char* argv[]) {
+    uint32_t kMax = 32;
+    size_t reps   = 10;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--kmax" && i + 1 < argc)
+            kMax = std::stoul(argv[++i]);
+        else if (arg == "--reps" && i + 1 < argc)
+            reps = std::stoul(argv[++i]);
+    }
+
+    CCParams<CryptoContextCKKSRNS> parameters;
+    parameters.SetMultiplicativeDepth(5);
+    parameters.SetScalingModSize(50);
+    parameters.SetScalingTechnique(FLEXIBLEAUTO);
+
+    CryptoContext<DCRTPoly> cc = GenCryptoContext(parameters);
+    cc->Enable(PKE);
+    cc->Enable(KEYSWITCH);
+    cc->Enable(LEVELEDSHE);
+
+    std::cout << "CKKS scheme is using ring dimension " << cc->GetRingDimension() << std::endl << std::endl;
+
+    auto keys = cc->KeyGen();
+    std::vector<int32_t> allIndices;
+    for (uint32_t k = 1; k <= kMax; ++k)
+        allIndices.push_back(static_cast<int32_t>(k));
+    cc->EvalRotateKeyGen(keys.secretKey, allIndices);
+
+    std::vector<std::complex<double>> x(cc->GetRingDimension() / 2);
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    for (auto& v : x)
+        v = dist(rng);
+    auto c = cc->Encrypt(keys.publicKey, cc->MakeCKKSPackedPlaintext(x));
+
+    TracePolicy policy;
+    policy.mode = TRACE_OFF;
+    auto backend = std::make_shared<OpenFHETraceBackend<DCRTPoly>>(cc, keys);
+    TraceableCiphertext<DCRTPoly> tc(backend, x, c, policy);
+
+    std::cout << std::setw(4) << "k" << std::setw(16) << "independent(ms)" << std::setw(14) << "hoisted(ms)"
+              << std::setw(14) << "traced(ms)" << std::setw(10) << "speedup" << std::endl;
+
+    for (uint32_t k = 1; k <= kMax; k *= 2) {
+        std::vector<int32_t> indices(allIndices.begin(), allIndices.begin() + k);
+        std::vector<double> independent, hoisted, traced;
+        std::vector<Ciphertext<DCRTPoly>> out(k);
+        TimeVar t;
+        for (size_t r = 0; r < reps; ++r) {
+            TIC(t);
+            for (uint32_t i = 0; i < k; ++i)
+                out[i] = cc->EvalRotate(c, indices[i]);
+            independent.push_back(TOC(t) * 1000);
+
+            TIC(t);
+            auto precomp = cc->EvalFastRotationPrecompute(c);
+            for (uint32_t i = 0; i < k; ++i)
+                out[i] = cc->EvalFastRotation(c, indices[i], cc->GetCyclotomicOrder(), precomp);
+            hoisted.push_back(TOC(t) * 1000);
+
+            TIC(t);
+            auto rotated = tc.cipherRotate(indices);
+            traced.push_back(TOC(t) * 1000);
+        }
+        bench::BenchResult ind = bench::summarize(independent);
+        bench::BenchResult hst = bench::summarize(hoisted);
+        bench::BenchResult trc = bench::summarize(traced);
+        std::cout << std::fixed << std::setprecision(2) << std::setw(4) << k << std::setw(16) << ind.medianUs / 1000
+                  << std::setw(14) << hst.medianUs / 1000 << std::setw(14) << trc.medianUs / 1000 << std::setw(9)
+                  << ind.medianUs / hst.medianUs << "x" << std::defaultfloat << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,120 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Rotation key store benchmark (OpenFHE)
+  index 1..N의 rotation key를 디스크에 두고, 앞쪽 index에 치우친 EvalRotate 요청을 메모리 상한별로 실행
+  모든 키를 메모리에 둔 경우와 rotation당 시간, hit rate, load 지연시간, 최대 상주 메모리 비교
+ */
+
+#include "openfhe.h"
+#include "eval-key-store.h"
+#include "bench-util.h"
+
+#include <random>
+#include <sstream>
+
+using namespace lbcrypto;
+
+// 사용법: openfhe-key-store-bench [--steps 32] [--rotations 512] [--dir openfhe-rotation-keys]
+int main(int argc, char* argv[]) {
+    int32_t numSteps = 32;
+    size_t rotations = 512;
+    std::string dir  = "openfhe-rotation-keys";
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--steps" && i + 1 < argc)
+            numSteps = std::stoi(argv[++i]);
+        else if (arg == "--rotations" && i + 1 < argc)
+            rotations = std::stoul(argv[++i]);
+        else if (arg == "--dir" && i + 1 < argc)
+            dir = argv[++i];
+    }
+
+    CCParams<CryptoContextCKKSRNS> parameters;
+    parameters.SetMultiplicativeDepth(5);
+    parameters.SetScalingModSize(50);
+    parameters.SetScalingTechnique(FLEXIBLEAUTO);
+
+    CryptoContext<DCRTPoly> cc = GenCryptoContext(parameters);
+    cc->Enable(PKE);
+    cc->Enable(KEYSWITCH);
+    cc->Enable(LEVELEDSHE);
+    auto keys = cc->KeyGen();
+
+    std::vector<int32_t> indices;
+    for (int32_t index = 1; index <= numSteps; ++index)
+        indices.push_back(index);
+    EvalKeyStore<DCRTPoly>::generate(cc, keys.secretKey, indices, dir);
+
+    // 요청의 80%는 앞쪽 20% index (회로의 inner loop), 나머지는 전체에서 고름
+    std::vector<int32_t> requests(rotations);
+    std::mt19937 rng(42);
+    std::uniform_int_distribution<int32_t> hot(1, std::max(1, numSteps / 5)), any(1, numSteps);
+    std::uniform_real_distribution<double> coin(0.0, 1.0);
+    for (auto& index : requests)
+        index = coin(rng) < 0.8 ? hot(rng) : any(rng);
+
+    std::vector<double> input(cc->GetRingDimension() / 2, 0.5);
+    auto ct = cc->Encrypt(keys.publicKey, cc->MakeCKKSPackedPlaintext(input));
+
+    // 기준: 모든 index의 키를 메모리에 둠
+    cc->EvalRotateKeyGen(keys.secretKey, indices);
+    size_t allBytes;
+    {
+        std::stringstream ss;
+        cc->SerializeEvalAutomorphismKey(ss, SerType::BINARY, keys.secretKey->GetKeyTag());
+        allBytes = ss.str().size();
+    }
+    TimeVar t;
+    TIC(t);
+    for (int32_t index : requests)
+        cc->EvalRotate(ct, index);
+    double allMs = TOC(t) / rotations;
+    cc->ClearEvalAutomorphismKeys();
+
+    std::cout << numSteps << " steps, " << rotations << " rotations, ring dimension " << cc->GetRingDimension()
+              << std::endl
+              << std::fixed << std::setprecision(2);
+    std::cout << "    + all keys in memory: " << allMs << " ms/rotation, " << allBytes / (1024.0 * 1024.0) << " MB"
+              << std::endl;
+    for (double fraction : {1.0, 0.5, 0.25, 0.1}) {
+        EvalKeyStore<DCRTPoly> store(cc, dir, static_cast<size_t>(fraction * allBytes));
+        TIC(t);
+        for (int32_t index : requests)
+            store.rotate(ct, index);
+        double ms = TOC(t) / rotations;
+        std::cout << "    + store cap " << std::setw(3) << static_cast<int>(100 * fraction) << "%: " << ms
+                  << " ms/rotation" << std::endl;
+        printKeyCacheStats("      key store", store.getStats());
+    }
+    return 0;
+}
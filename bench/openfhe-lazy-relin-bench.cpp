@@ -0,0 +1,133 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Lazy relinearization benchmark (OpenFHE)
+  내적 형태 회로 sum_i a_i * b_i 를
+  - eager: EvalMult(곱셈마다 relinearize) + EvalAdd (TraceableCiphertext::cipherMult 방식)
+  - lazy: EvalMultNoRelin + EvalAddInPlace 후 Relinearize 1번
+  으로 계산해서 key switching 횟수, 지연시간, 최대 오차 비교
+ */
+
+#include "openfhe.h"
+#include "bench-util.h"
+
+#include <random>
+
+using namespace lbcrypto;
+
+// 사용법: openfhe-lazy-relin-bench [--terms 32] [--reps 10]
+int main(int argc, char* argv[]) {
+    size_t maxTerms = 32;
+    size_t reps     = 10;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--terms" && i + 1 < argc)
+            maxTerms = std::stoul(argv[++i]);
+        else if (arg == "--reps" && i + 1 < argc)
+            reps = std::stoul(argv[++i]);
+    }
+
+    CCParams<CryptoContextCKKSRNS> parameters;
+    parameters.SetMultiplicativeDepth(2);
+    parameters.SetScalingModSize(50);
+    parameters.SetScalingTechnique(FLEXIBLEAUTO);
+
+    CryptoContext<DCRTPoly> cc = GenCryptoContext(parameters);
+    cc->Enable(PKE);
+    cc->Enable(KEYSWITCH);
+    cc->Enable(LEVELEDSHE);
+
+    std::cout << "CKKS scheme is using ring dimension " << cc->GetRingDimension() << std::endl << std::endl;
+
+    auto keys = cc->KeyGen();
+    cc->EvalMultKeyGen(keys.secretKey);
+
+    size_t slots = cc->GetRingDimension() / 2;
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    std::vector<std::vector<double>> a(maxTerms, std::vector<double>(slots)), b(maxTerms, std::vector<double>(slots));
+    std::vector<Ciphertext<DCRTPoly>> ca(maxTerms), cb(maxTerms);
+    for (size_t t = 0; t < maxTerms; ++t) {
+        for (size_t i = 0; i < slots; ++i) {
+            a[t][i] = dist(rng);
+            b[t][i] = dist(rng);
+        }
+        ca[t] = cc->Encrypt(keys.publicKey, cc->MakeCKKSPackedPlaintext(a[t]));
+        cb[t] = cc->Encrypt(keys.publicKey, cc->MakeCKKSPackedPlaintext(b[t]));
+    }
+
+    std::cout << std::setw(6) << "terms" << std::setw(8) << "mode" << std::setw(8) << "relins" << std::setw(12)
+              << "median(ms)" << std::setw(12) << "max err" << std::endl;
+
+    for (size_t terms = 2; terms <= maxTerms; terms *= 2) {
+        std::vector<double> expected(slots, 0.0);
+        for (size_t t = 0; t < terms; ++t)
+            for (size_t i = 0; i < slots; ++i)
+                expected[i] += a[t][i] * b[t][i];
+
+        auto report = [&](const std::string& mode, size_t relins, const std::vector<double>& samples,
+                          const Ciphertext<DCRTPoly>& out) {
+            Plaintext result;
+            cc->Decrypt(keys.secretKey, out, &result);
+            result->SetLength(slots);
+            const auto& values = result->GetCKKSPackedValue();
+            double err         = 0;
+            for (size_t i = 0; i < slots; ++i)
+                err = std::max(err, std::abs(values[i].real() - expected[i]));
+            std::cout << std::setw(6) << terms << std::setw(8) << mode << std::setw(8) << relins << std::fixed
+                      << std::setprecision(2) << std::setw(12) << bench::summarize(samples).medianUs
+                      << std::scientific << std::setprecision(2) << std::setw(12) << err << std::defaultfloat
+                      << std::endl;
+        };
+
+        std::vector<double> eager, lazy;
+        Ciphertext<DCRTPoly> outEager, outLazy;
+        TimeVar t;
+        for (size_t r = 0; r < reps; ++r) {
+            TIC(t);
+            outEager = cc->EvalMult(ca[0], cb[0]);
+            for (size_t i = 1; i < terms; ++i)
+                outEager = cc->EvalAdd(outEager, cc->EvalMult(ca[i], cb[i]));
+            eager.push_back(TOC(t));
+
+            TIC(t);
+            outLazy = cc->EvalMultNoRelin(ca[0], cb[0]);
+            for (size_t i = 1; i < terms; ++i)
+                cc->EvalAddInPlace(outLazy, cc->EvalMultNoRelin(ca[i], cb[i]));
+            cc->RelinearizeInPlace(outLazy);
+            lazy.push_back(TOC(t));
+        }
+        report("eager", terms, eager, outEager);
+        report("lazy", 1, lazy, outLazy);
+    }
+    return 0;
+}
@@ -0,0 +1,210 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Polynomial evaluation benchmark
+  PolyEvaluator(depthSlack 0, 1)를 OpenFHE EvalPoly, 직접 작성한 회로(PI*x^3 + 0.4x + 1, (x+1)^2(x^2+2))와 비교
+  차수 3 ~ 63의 임의 계수 다항식에 대해 소모 레벨, 암호문 곱셈 수, 지연시간, 최대 오차 출력
+ */
+
+#include "openfhe.h"
+#include "openfhe-poly-backend.h"
+#include "bench-util.h"
+
+#include <functional>
+#include <random>
+#include <stdexcept>
+
+using namespace lbcrypto;
+
+namespace {
+
+// 소모한 레벨 (FLEXIBLEAUTO에서는 마지막 rescale이 다음 연산까지 미뤄지므로 noise scale degree도 포함)
+uint32_t levelsUsed(const Ciphertext<DCRTPoly>& ct) {
+    return static_cast<uint32_t>(ct->GetLevel() + ct->GetNoiseScaleDeg() - 1);
+}
+
+double maxError(CryptoContext<DCRTPoly>& cc, const PrivateKey<DCRTPoly>& sk, const Ciphertext<DCRTPoly>& ct,
+                const std::vector<double>& expected) {
+    Plaintext result;
+    cc->Decrypt(sk, ct, &result);
+    result->SetLength(expected.size());
+    const auto& values = result->GetCKKSPackedValue();
+    double err         = 0;
+    for (size_t i = 0; i < expected.size(); ++i)
+        err = std::max(err, std::abs(values[i].real() - expected[i]));
+    return err;
+}
+
+double horner(const std::vector<double>& coeffs, double x) {
+    double y = 0;
+    for (size_t i = coeffs.size(); i-- > 0;)
+        y = y * x + coeffs[i];
+    return y;
+}
+
+struct Row {
+    std::string name;
+    size_t degree;
+    uint32_t levels;
+    uint32_t ctMults;   // 0: 알 수 없음 (EvalPoly)
+    double medianMs;
+    double error;
+};
+
+void printRow(const Row& r) {
+    std::cout << std::setw(28) << std::left << r.name << std::right << std::setw(7) << r.degree << std::setw(8)
+              << r.levels << std::setw(9);
+    if (r.ctMults)
+        std::cout << r.ctMults;
+    else
+        std::cout << "-";
+    std::cout << std::fixed << std::setprecision(2) << std::setw(12) << r.medianMs << std::scientific
+              << std::setprecision(2) << std::setw(12) << r.error << std::defaultfloat << std::endl;
+}
+
+}  // namespace
+
+// 사용법: openfhe-poly-eval-bench [--reps 5] [--max-degree 63]
+int main(int argc, char* argv[]) {
+    size_t reps      = 5;
+    size_t maxDegree = 63;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--reps" && i + 1 < argc)
+            reps = std::stoul(argv[++i]);
+        else if (arg == "--max-degree" && i + 1 < argc)
+            maxDegree = std::stoul(argv[++i]);
+    }
+
+    // 빈 계수, 상수 다항식(상수 인수)은 암호문 연산 전에 std::invalid_argument로 거부되어야 함
+    SymbolicPolyBackend symbolic;
+    PolyEvaluator<SymbolicPolyBackend> checker(symbolic);
+    for (const std::vector<double>& coeffs : std::vector<std::vector<double>>{{}, {2.0}, {2.0, 0.0, 0.0}}) {
+        const std::vector<std::function<void()>> calls{
+            [&]() { PolyEvaluator<SymbolicPolyBackend>::plan(coeffs); },
+            [&]() { checker.evaluate({}, coeffs); },
+            [&]() { checker.evaluateFactored({}, {{1.0, 1.0}, coeffs}); }};
+        for (const auto& call : calls) {
+            try {
+                call();
+                std::cerr << "PolyEvaluator accepted a polynomial of degree < 1" << std::endl;
+                return 1;
+            }
+            catch (const std::invalid_argument&) {
+            }
+        }
+    }
+
+    CCParams<CryptoContextCKKSRNS> parameters;
+    parameters.SetMultiplicativeDepth(8);
+    parameters.SetScalingModSize(50);
+    parameters.SetScalingTechnique(FLEXIBLEAUTO);
+
+    CryptoContext<DCRTPoly> cc = GenCryptoContext(parameters);
+    cc->Enable(PKE);
+    cc->Enable(KEYSWITCH);
+    cc->Enable(LEVELEDSHE);
+    cc->Enable(ADVANCEDSHE);
+
+    std::cout << "CKKS scheme is using ring dimension " << cc->GetRingDimension() << std::endl << std::endl;
+
+    auto keys = cc->KeyGen();
+    cc->EvalMultKeyGen(keys.secretKey);
+
+    std::vector<double> x(cc->GetRingDimension() / 2);
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    for (auto& v : x)
+        v = dist(rng);
+    auto c = cc->Encrypt(keys.publicKey, cc->MakeCKKSPackedPlaintext(x));
+
+    OpenFHEPolyBackend<DCRTPoly> backend(cc);
+    PolyEvaluator<OpenFHEPolyBackend<DCRTPoly>> evaluator(backend);
+
+    auto measure = [&](const std::string& name, size_t degree, uint32_t ctMults, const std::vector<double>& coeffs,
+                       const std::function<Ciphertext<DCRTPoly>()>& circuit) {
+        std::vector<double> samples;
+        Ciphertext<DCRTPoly> out;
+        TimeVar t;
+        for (size_t r = 0; r < reps; ++r) {
+            TIC(t);
+            out = circuit();
+            samples.push_back(TOC(t));
+        }
+        std::vector<double> expected(x.size());
+        for (size_t i = 0; i < x.size(); ++i)
+            expected[i] = horner(coeffs, x[i]);
+        printRow({name, degree, levelsUsed(out), ctMults, bench::summarize(samples).medianUs,
+                  maxError(cc, keys.secretKey, out, expected)});
+    };
+
+    std::cout << std::setw(28) << std::left << "circuit" << std::right << std::setw(7) << "degree" << std::setw(8)
+              << "levels" << std::setw(9) << "ctMults" << std::setw(12) << "median(ms)" << std::setw(12) << "max err"
+              << std::endl;
+
+    // 직접 작성한 회로와 같은 다항식
+    const std::vector<double> cubic{1.0, 0.4, 0.0, 3.14159265};
+    measure("hand: PI*x^3+0.4x+1", 3, 2, cubic, [&]() {
+        auto x2 = cc->EvalSquare(c);
+        auto x3 = cc->EvalMult(x2, cc->EvalMult(c, 3.14159265));
+        return cc->EvalAdd(cc->EvalAdd(x3, cc->EvalMult(c, 0.4)), 1.0);
+    });
+    measure("PolyEvaluator: PI*x^3+0.4x+1", 3, PolyEvaluator<SymbolicPolyBackend>::plan(cubic).second.ctMults, cubic,
+            [&]() { return evaluator.evaluate(c, cubic); });
+
+    // (x+1)^2 (x^2+2) = x^4 + 2x^3 + 3x^2 + 4x + 2
+    const std::vector<double> quartic{2.0, 4.0, 3.0, 2.0, 1.0};
+    measure("hand: (x+1)^2(x^2+2)", 4, 3, quartic, [&]() {
+        auto x1 = cc->EvalAdd(c, 1.0);
+        return cc->EvalMult(cc->EvalSquare(x1), cc->EvalAdd(cc->EvalSquare(c), 2.0));
+    });
+    measure("PolyEvaluator: expanded", 4, PolyEvaluator<SymbolicPolyBackend>::plan(quartic).second.ctMults, quartic,
+            [&]() { return evaluator.evaluate(c, quartic); });
+    measure("PolyEvaluator: factored", 4, 3, quartic,
+            [&]() { return evaluator.evaluateFactored(c, {{1.0, 1.0}, {1.0, 1.0}, {2.0, 0.0, 1.0}}); });
+
+    // 임의 계수 다항식
+    for (size_t degree : {3, 5, 7, 15, 31, 63}) {
+        if (degree > maxDegree)
+            break;
+        std::vector<double> coeffs(degree + 1);
+        for (auto& v : coeffs)
+            v = dist(rng);
+        for (uint32_t slack : {0u, 1u}) {
+            auto planned = PolyEvaluator<SymbolicPolyBackend>::plan(coeffs, slack);
+            measure("PolyEvaluator slack " + std::to_string(slack), degree, planned.second.ctMults, coeffs,
+                    [&]() { return evaluator.evaluate(c, coeffs, slack); });
+        }
+        measure("EvalPoly", degree, 0, coeffs, [&]() { return cc->EvalPoly(c, coeffs); });
+    }
+    return 0;
+}
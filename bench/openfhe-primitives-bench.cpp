@@ -0,0 +1,159 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Per-primitive microbenchmark for OpenFHE CKKS
+  encode, encrypt, add, add_plain, multiply, relinearize, rescale, mod_switch, rotate, decrypt
+  ring dimension(2^13 ~ 2^16)과 남은 레벨별로 측정
+  OpenMP 스레드는 1개로 고정: PerfCounters는 호출한 스레드만 세므로 worker 스레드의 NTT, key switching이 빠지지 않도록.
+  SEAL(seal_primitives_bench)도 단일 스레드이므로 같은 조건에서 비교
+ */
+
+#include "openfhe.h"
+#include "bench-util.h"
+
+#include <random>
+
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
+using namespace lbcrypto;
+
+// 주어진 ring dimension에서 128-bit 보안을 만족하는 가장 깊은 depth로 context 생성. 실패하면 nullptr
+CryptoContext<DCRTPoly> MakeBenchContext(uint32_t logN, uint32_t& depth) {
+    const uint32_t ringDim = 1u << logN;
+    for (depth = (ringDim / 1024) * 3 / 4; depth >= 1; --depth) {    // 40비트 limb 기준 대략적인 상한에서 시작
+        try {
+            CCParams<CryptoContextCKKSRNS> parameters;
+            parameters.SetSecurityLevel(HEStd_128_classic);
+            parameters.SetRingDim(ringDim);
+            parameters.SetMultiplicativeDepth(depth);
+            parameters.SetFirstModSize(60);
+            parameters.SetScalingModSize(40);
+            parameters.SetScalingTechnique(FIXEDMANUAL);     // rescale을 직접 측정하기 위해 수동 모드 사용
+            parameters.SetBatchSize(ringDim / 2);
+
+            CryptoContext<DCRTPoly> cc = GenCryptoContext(parameters);
+            if (cc->GetRingDimension() == ringDim)
+                return cc;
+        }
+        catch (const std::exception&) {
+            // 보안 조건을 만족하지 못하는 depth. 한 단계 낮춰서 재시도
+        }
+    }
+    return nullptr;
+}
+
+void BenchRing(bench::Runner& runner, uint32_t logN, bool allLevels) {
+    uint32_t depth             = 0;
+    CryptoContext<DCRTPoly> cc = MakeBenchContext(logN, depth);
+    if (!cc) {
+        std::cout << "No secure CKKS context for ring dimension 2^" << logN << std::endl;
+        return;
+    }
+    cc->Enable(PKE);
+    cc->Enable(KEYSWITCH);
+    cc->Enable(LEVELEDSHE);
+
+    auto keys = cc->KeyGen();
+    cc->EvalMultKeyGen(keys.secretKey);
+    cc->EvalRotateKeyGen(keys.secretKey, {1});
+
+    std::vector<double> x(cc->GetRingDimension() / 2);
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    for (auto& v : x)
+        v = dist(rng);
+
+    // level = 남은 곱셈 횟수 (SEAL의 chain index와 같은 의미). OpenFHE에서는 depth - level번 rescale된 상태
+    for (uint32_t level = depth; level >= 1; --level) {
+        if (!allLevels && level != depth && level != (depth + 1) / 2 && level != 1)
+            continue;
+        const uint32_t consumed = depth - level;
+
+        Plaintext pt = cc->MakeCKKSPackedPlaintext(x, 1, consumed);
+        auto ct1     = cc->Encrypt(keys.publicKey, pt);
+        auto ct2     = cc->Encrypt(keys.publicKey, pt);
+        auto ctSize3 = cc->EvalMultNoRelin(ct1, ct2);
+        auto ctRelin = cc->Relinearize(ctSize3);
+        Ciphertext<DCRTPoly> out;
+        Plaintext ptOut;
+
+        runner.run("OpenFHE", "encode", logN, level, [&]() { ptOut = cc->MakeCKKSPackedPlaintext(x, 1, consumed); });
+        runner.run("OpenFHE", "encrypt", logN, level, [&]() { out = cc->Encrypt(keys.publicKey, pt); });
+        runner.run("OpenFHE", "add", logN, level, [&]() { out = cc->EvalAdd(ct1, ct2); });
+        runner.run("OpenFHE", "add_plain", logN, level, [&]() { out = cc->EvalAdd(ct1, pt); });
+        runner.run("OpenFHE", "multiply", logN, level, [&]() { out = cc->EvalMultNoRelin(ct1, ct2); });
+        runner.run("OpenFHE", "relinearize", logN, level, [&]() { out = cc->Relinearize(ctSize3); });
+        runner.run("OpenFHE", "rescale", logN, level, [&]() { out = cc->Rescale(ctRelin); });
+        runner.run("OpenFHE", "mod_switch", logN, level, [&]() { out = cc->LevelReduce(ct1, nullptr, 1); });
+        runner.run("OpenFHE", "rotate", logN, level, [&]() { out = cc->EvalRotate(ct1, 1); });
+        // OpenFHE의 Decrypt는 복호화와 디코딩을 함께 수행하므로 decode를 따로 측정할 수 없음
+        runner.run("OpenFHE", "decrypt+decode", logN, level, [&]() { cc->Decrypt(keys.secretKey, ct1, &ptOut); });
+    }
+}
+
+// 사용법: openfhe-primitives-bench [--logn 13-16] [--reps 10] [--all-levels] [--csv out.csv]
+int main(int argc, char* argv[]) {
+    std::pair<uint32_t, uint32_t> logNRange{13, 16};
+    size_t reps    = 10;
+    bool allLevels = false;
+    std::string csvPath;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--logn" && i + 1 < argc)
+            logNRange = bench::parseRange(argv[++i]);
+        else if (arg == "--reps" && i + 1 < argc)
+            reps = std::stoul(argv[++i]);
+        else if (arg == "--all-levels")
+            allLevels = true;
+        else if (arg == "--csv" && i + 1 < argc)
+            csvPath = argv[++i];
+    }
+
+#ifdef _OPENMP
+    omp_set_num_threads(1);     // context 생성 전에: 모든 연산이 이 스레드에서 실행되어 counter에 잡힘
+#endif
+    bench::Runner runner(reps);
+    if (!runner.countersAvailable()) {
+        std::cout << "perf_event_open unavailable (check /proc/sys/kernel/perf_event_paranoid): hardware counters disabled"
+                  << std::endl;
+    }
+    bench::Runner::printHeader();
+    for (uint32_t logN = logNRange.first; logN <= logNRange.second; ++logN) {
+        BenchRing(runner, logN, allLevels);
+    }
+    if (!csvPath.empty())
+        runner.writeCsv(csvPath);
+
+    return 0;
+}
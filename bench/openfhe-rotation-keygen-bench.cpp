@@ -0,0 +1,122 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Rotation key 생성 비교: 모든 ±2^i index vs 회로가 실제로 사용하는 index만 생성
+  (TraceableCiphertext가 저장한 rotation-steps.txt)
+ */
+
+#include "openfhe.h"
+#include "cryptocontext-ser.h"
+#include "key/key-ser.h"
+#include "scheme/ckksrns/ckksrns-ser.h"
+#include "rotation-steps.h"
+
+#include <sstream>
+
+using namespace lbcrypto;
+
+struct KeyGenStat {
+    size_t keys  = 0;
+    double ms    = 0;
+    size_t bytes = 0;
+};
+
+KeyGenStat GenRotationKeys(CryptoContext<DCRTPoly>& cc, const KeyPair<DCRTPoly>& keys,
+                           const std::vector<int32_t>& indices) {
+    KeyGenStat stat;
+    stat.keys = indices.size();
+    TimeVar t;
+    TIC(t);
+    cc->EvalRotateKeyGen(keys.secretKey, indices);
+    stat.ms = TOC(t);
+
+    std::stringstream ss;
+    cc->SerializeEvalAutomorphismKey(ss, SerType::BINARY, keys.secretKey->GetKeyTag());
+    stat.bytes = ss.str().size();
+    cc->ClearEvalAutomorphismKeys();
+    return stat;
+}
+
+// 사용법: openfhe-rotation-keygen-bench [--steps-file rotation-steps.txt | --steps 2,3]
+int main(int argc, char* argv[]) {
+    RotationSteps steps;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--steps-file" && i + 1 < argc) {
+            if (!steps.load(argv[++i])) {
+                std::cout << "Cannot read " << argv[i] << std::endl;
+                return 1;
+            }
+        }
+        else if (arg == "--steps" && i + 1 < argc) {
+            std::stringstream ss(argv[++i]);
+            std::string item;
+            while (std::getline(ss, item, ','))
+                steps.add(std::stoi(item));
+        }
+    }
+    if (steps.empty())
+        steps.add(2);   // task4의 left rotation 2
+
+    CCParams<CryptoContextCKKSRNS> parameters;
+    parameters.SetMultiplicativeDepth(5);
+    parameters.SetScalingModSize(50);
+    parameters.SetScalingTechnique(FLEXIBLEAUTO);
+
+    CryptoContext<DCRTPoly> cc = GenCryptoContext(parameters);
+    cc->Enable(PKE);
+    cc->Enable(KEYSWITCH);
+    cc->Enable(LEVELEDSHE);
+    auto keys = cc->KeyGen();
+
+    // SEAL의 create_galois_keys()와 같은 기준: 모든 ±2^i 회전
+    std::vector<int32_t> powerOfTwo;
+    for (int32_t i = 1; i < static_cast<int32_t>(cc->GetRingDimension() / 2); i *= 2) {
+        powerOfTwo.push_back(i);
+        powerOfTwo.push_back(-i);
+    }
+
+    KeyGenStat all = GenRotationKeys(cc, keys, powerOfTwo);
+    KeyGenStat min = GenRotationKeys(cc, keys, steps.toIndices());
+
+    std::cout << "Ring dimension: " << cc->GetRingDimension() << ", steps used by circuit:";
+    for (int32_t step : steps.toIndices())
+        std::cout << " " << step;
+    std::cout << std::endl << std::fixed << std::setprecision(2);
+    std::cout << "    + all power-of-two steps: " << all.keys << " keys, " << all.bytes / (1024.0 * 1024.0) << " MB, "
+              << all.ms << " ms" << std::endl;
+    std::cout << "    + circuit steps only    : " << min.keys << " keys, " << min.bytes / (1024.0 * 1024.0) << " MB, "
+              << min.ms << " ms" << std::endl;
+    std::cout << "    + saved                 : " << (static_cast<double>(all.bytes) - min.bytes) / (1024.0 * 1024.0) << " MB, "
+              << all.ms - min.ms << " ms" << std::endl;
+    return 0;
+}
@@ -0,0 +1,141 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Multi-tenant slot packing throughput (OpenFHE)
+  길이 8인 tenant 벡터마다 (x+1)^2(x^2+2)를 계산하고 왼쪽으로 2 회전 (traceable-cipher-test와 같은 회로)
+  - separate: tenant마다 SetBatchSize(8) 암호문 하나 (일부 tenant만 측정해서 tenant당 시간 계산)
+  - packed: 모든 tenant를 암호문 하나에 넣고 한 번 평가 (PackedEvaluator, block 안 회전)
+  tenant/s, speedup, 평문 계산과의 최대 오차 출력
+ */
+
+#include "openfhe.h"
+#include "openfhe-slot-packing.h"
+#include "bench-util.h"
+
+#include <random>
+
+using namespace lbcrypto;
+
+static CryptoContext<DCRTPoly> MakeContext(uint32_t batchSize) {
+    CCParams<CryptoContextCKKSRNS> parameters;
+    parameters.SetMultiplicativeDepth(4);   // 회로 2 + 곱셈 1 + block 회전 mask 1
+    parameters.SetScalingModSize(50);
+    parameters.SetScalingTechnique(FLEXIBLEAUTO);
+    parameters.SetBatchSize(batchSize);
+    parameters.SetRingDim(16384);
+    CryptoContext<DCRTPoly> cc = GenCryptoContext(parameters);
+    cc->Enable(PKE);
+    cc->Enable(KEYSWITCH);
+    cc->Enable(LEVELEDSHE);
+    return cc;
+}
+
+// 사용법: openfhe-slot-packing-bench [--tenants 0(=최대)] [--separate 16]
+int main(int argc, char* argv[]) {
+    const size_t width    = 8;
+    const int32_t shift   = 2;
+    size_t tenantCount    = 0;
+    size_t separateSample = 16;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--tenants" && i + 1 < argc)
+            tenantCount = std::stoul(argv[++i]);
+        else if (arg == "--separate" && i + 1 < argc)
+            separateSample = std::stoul(argv[++i]);
+    }
+
+    const uint32_t slots = 16384 / 2;
+    CryptoContext<DCRTPoly> packedCc = MakeContext(slots);
+    SlotPacker packer(slots, width);
+    if (tenantCount == 0 || tenantCount > packer.capacity())
+        tenantCount = packer.capacity();
+    separateSample = std::min(separateSample, tenantCount);
+
+    std::vector<std::vector<double>> tenants(tenantCount, std::vector<double>(width));
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> dist(0.0, 1.0);
+    for (auto& t : tenants) {
+        for (auto& v : t)
+            v = dist(rng);
+    }
+    auto circuit = [](double x) { return (x + 1) * (x + 1) * (x * x + 2); };
+
+    // separate: tenant마다 batch size 8 암호문
+    CryptoContext<DCRTPoly> cc = MakeContext(width);
+    auto keys                  = cc->KeyGen();
+    cc->EvalMultKeyGen(keys.secretKey);
+    cc->EvalRotateKeyGen(keys.secretKey, {shift});
+    std::vector<Ciphertext<DCRTPoly>> separate(separateSample);
+    for (size_t t = 0; t < separateSample; ++t)
+        separate[t] = cc->Encrypt(keys.publicKey, cc->MakeCKKSPackedPlaintext(tenants[t]));
+    TimeVar timer;
+    TIC(timer);
+    for (auto& c : separate) {
+        auto cplus1 = cc->EvalAdd(c, 1.0);
+        auto res    = cc->EvalMult(cc->EvalMult(cplus1, cplus1), cc->EvalAdd(cc->EvalMult(c, c), 2.0));
+        c           = cc->EvalRotate(res, shift);
+    }
+    double separateMs = TOC(timer) / separateSample;
+
+    // packed: 모든 tenant를 암호문 하나에
+    PackedEvaluator<DCRTPoly> packed(packedCc, packer);
+    auto packedKeys = packedCc->KeyGen();
+    packedCc->EvalMultKeyGen(packedKeys.secretKey);
+    packedCc->EvalRotateKeyGen(packedKeys.secretKey, packed.rotationIndices({shift}));
+    auto c = packed.encrypt(packedKeys.publicKey, tenants);
+    TIC(timer);
+    auto cplus1 = packedCc->EvalAdd(c, 1.0);
+    auto res    = packedCc->EvalMult(packedCc->EvalMult(cplus1, cplus1), packedCc->EvalAdd(packedCc->EvalMult(c, c), 2.0));
+    auto rot    = packed.rotateWithinBlocks(res, shift);
+
+    double packedMs = TOC(timer);
+
+    std::vector<size_t> lengths(tenantCount, width);
+    auto results    = packed.decrypt(packedKeys.secretKey, rot, lengths);
+    double maxError = 0;
+    for (size_t t = 0; t < tenantCount; ++t) {
+        for (size_t j = 0; j < width; ++j) {
+            double expected = circuit(tenants[t][(j + shift) % width]);
+            maxError        = std::max(maxError, std::abs(results[t][j] - expected));
+        }
+    }
+
+    std::cout << tenantCount << " tenants x " << width << " slots, ring dimension " << packedCc->GetRingDimension()
+              << std::endl
+              << std::fixed << std::setprecision(2);
+    std::cout << "    + separate: " << separateMs << " ms/tenant, " << 1000 / separateMs << " tenants/s" << std::endl;
+    std::cout << "    + packed  : " << packedMs << " ms for all, " << 1000 * tenantCount / packedMs << " tenants/s"
+              << std::endl;
+    std::cout << "    + speedup : " << separateMs * tenantCount / packedMs << "x" << std::endl;
+    std::cout << std::scientific << "    + max error vs plaintext: " << maxError << std::endl;
+    return 0;
+}
@@ -0,0 +1,168 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+/*
+  Async branch execution (SEAL)
+  y = sum_i (x+i)^2 * (x^2+i), i = 1..branches. 가지끼리는 독립이고 합은 이진 트리로 더함
+  - sequential: AutoEvaluator를 한 스레드에서 순서대로 호출
+  - async: AsyncEvaluator(task3)가 준비된 연산부터 worker에서 병렬 실행
+  회로 하나의 latency, 동시에 실행된 연산 수의 최댓값, 최대 오차 출력
+ */
+
+#include "seal/seal.h"
+#include "seal-async-evaluator.h"
+#include "bench-util.h"
+#include <random>
+
+using namespace std;
+using namespace seal;
+
+// 항들을 이진 트리로 더함
+template <typename T, typename Add>
+T sum_tree(vector<T> terms, Add add)
+{
+    while (terms.size() > 1)
+    {
+        vector<T> next;
+        for (size_t i = 0; i + 1 < terms.size(); i += 2)
+        {
+            next.push_back(add(terms[i], terms[i + 1]));
+        }
+        if (terms.size() % 2)
+        {
+            next.push_back(terms.back());
+        }
+        terms = move(next);
+    }
+    return terms[0];
+}
+
+// 사용법: seal_async_bench [--branches 8] [--workers 0(코어 수)] [--reps 10]
+int main(int argc, char *argv[])
+{
+    size_t max_branches = 8;
+    size_t workers = 0;
+    size_t reps = 10;
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg == "--branches" && i + 1 < argc)
+            max_branches = stoul(argv[++i]);
+        else if (arg == "--workers" && i + 1 < argc)
+            workers = stoul(argv[++i]);
+        else if (arg == "--reps" && i + 1 < argc)
+            reps = stoul(argv[++i]);
+    }
+    if (workers == 0)
+    {
+        workers = max<size_t>(thread::hardware_concurrency(), 1);
+    }
+
+    EncryptionParameters parms(scheme_type::ckks);
+    size_t poly_modulus_degree = 16384;
+    parms.set_poly_modulus_degree(poly_modulus_degree);
+    parms.set_coeff_modulus(CoeffModulus::Create(poly_modulus_degree, { 60, 50, 50, 50, 60 }));
+    double scale = pow(2.0, 50);
+
+    SEALContext context(parms);
+    KeyGenerator keygen(context);
+    auto secret_key = keygen.secret_key();
+    PublicKey public_key;
+    keygen.create_public_key(public_key);
+    RelinKeys relin_keys;
+    keygen.create_relin_keys(relin_keys);
+    GaloisKeys galois_keys;
+    Encryptor encryptor(context, public_key);
+    Evaluator evaluator(context);
+    Decryptor decryptor(context, secret_key);
+    CKKSEncoder encoder(context);
+
+    size_t slot_count = encoder.slot_count();
+    vector<double> input(slot_count);
+    mt19937_64 rng(42);
+    uniform_real_distribution<double> dist(-1.0, 1.0);
+    for (auto &v : input)
+    {
+        v = dist(rng);
+    }
+    Plaintext plain;
+    encoder.encode(input, scale, plain);
+    Ciphertext x;
+    encryptor.encrypt(plain, x);
+
+    cout << workers << " workers" << endl;
+    bench::Runner runner(reps);
+    bench::Runner::printHeader();
+    for (size_t branches = 1; branches <= max_branches; branches *= 2)
+    {
+        const string suffix = "-b" + to_string(branches);
+        vector<double> expected(slot_count, 0.0);
+        for (size_t i = 1; i <= branches; i++)
+        {
+            for (size_t s = 0; s < slot_count; s++)
+            {
+                double v = input[s];
+                expected[s] += (v + i) * (v + i) * (v * v + i);
+            }
+        }
+
+        AutoEvaluator auto_evaluator(context, encoder, evaluator, relin_keys, scale);
+        Ciphertext sequential_result;
+        auto sequential = [&]() {
+            Ciphertext x2;
+            auto_evaluator.square(x, x2);
+            vector<Ciphertext> terms;
+            for (size_t i = 1; i <= branches; i++)
+            {
+                Ciphertext a, b, term;
+                auto_evaluator.add_const(x, static_cast<double>(i), a);
+                auto_evaluator.square(a, a);
+                auto_evaluator.add_const(x2, static_cast<double>(i), b);
+                auto_evaluator.multiply(a, b, term);
+                terms.push_back(move(term));
+            }
+            sequential_result = sum_tree(move(terms), [&](const Ciphertext &a, const Ciphertext &b) {
+                Ciphertext sum;
+                auto_evaluator.add(a, b, sum);
+                return sum;
+            });
+            auto_evaluator.finalize(sequential_result);
+        };
+        const double sequential_us = runner.run("SEAL", "seq" + suffix, 14, 0, sequential).medianUs;
+
+        AsyncEvaluator async_evaluator(context, encoder, relin_keys, galois_keys, scale, workers);
+        auto async = [&]() {
+            AsyncCiphertext ax = async_evaluator.input(x);
+            AsyncCiphertext x2 = async_evaluator.square(ax);
+            vector<AsyncCiphertext> terms;
+            for (size_t i = 1; i <= branches; i++)
+            {
+                const double c = static_cast<double>(i);
+                terms.push_back(async_evaluator.multiply(
+                    async_evaluator.square(async_evaluator.add_const(ax, c)), async_evaluator.add_const(x2, c)));
+            }
+            AsyncCiphertext sum = sum_tree(move(terms), [&](const AsyncCiphertext &a, const AsyncCiphertext &b) {
+                return async_evaluator.add(a, b);
+            });
+            return async_evaluator.finalize(sum);
+        };
+        const double async_us = runner.run("SEAL", "async" + suffix, 14, 0, [&]() { async().wait(); }).medianUs;
+
+        auto max_error = [&](const Ciphertext &result) {
+            Plaintext plain_result;
+            decryptor.decrypt(result, plain_result);
+            vector<double> decoded;
+            encoder.decode(plain_result, decoded);
+            double err = 0;
+            for (size_t s = 0; s < slot_count; s++)
+            {
+                err = max(err, fabs(decoded[s] - expected[s]));
+            }
+            return err;
+        };
+        cout << "    + speedup " << fixed << setprecision(2) << sequential_us / async_us << "x, max parallel ops "
+             << async_evaluator.max_parallelism() << ", max err seq " << scientific << max_error(sequential_result)
+             << ", async " << max_error(async().get()) << defaultfloat << endl;
+    }
+    return 0;
+}
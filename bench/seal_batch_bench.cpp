@@ -0,0 +1,123 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+/*
+  Batch evaluation throughput (SEAL)
+  my_ckks_prac.cpp의 (x+1)^2(x^2+2) 회로를 여러 암호문에 BatchExecutor(task3)로 적용하고
+  스레드 수 1 ~ 전체 코어에 대한 처리량(records/s)과 speedup 출력
+ */
+
+#include "seal/seal.h"
+#include "seal-batch-executor.h"
+#include "bench-util.h"
+#include <random>
+
+using namespace std;
+using namespace seal;
+
+vector<size_t> thread_counts()
+{
+    size_t cores = max<size_t>(thread::hardware_concurrency(), 1);
+    vector<size_t> counts;
+    for (size_t t = 1; t < cores; t *= 2)
+    {
+        counts.push_back(t);
+    }
+    counts.push_back(cores);
+    return counts;
+}
+
+// 사용법: seal_batch_bench [--records 1024] [--reps 3]
+int main(int argc, char *argv[])
+{
+    size_t records = 1024;
+    size_t reps = 3;
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg == "--records" && i + 1 < argc)
+            records = stoul(argv[++i]);
+        else if (arg == "--reps" && i + 1 < argc)
+            reps = stoul(argv[++i]);
+    }
+
+    EncryptionParameters parms(scheme_type::ckks);
+    size_t poly_modulus_degree = 16384;
+    parms.set_poly_modulus_degree(poly_modulus_degree);
+    parms.set_coeff_modulus(CoeffModulus::Create(poly_modulus_degree, { 60, 50, 50, 50, 50, 60 }));
+    double scale = pow(2.0, 50);
+
+    SEALContext context(parms);
+    KeyGenerator keygen(context);
+    PublicKey public_key;
+    keygen.create_public_key(public_key);
+    RelinKeys relin_keys;
+    keygen.create_relin_keys(relin_keys);
+    Encryptor encryptor(context, public_key);
+    CKKSEncoder encoder(context);
+
+    cout << "Encrypting " << records << " records (poly_modulus_degree " << poly_modulus_degree << ")" << endl;
+    vector<double> input(encoder.slot_count());
+    mt19937_64 rng(42);
+    uniform_real_distribution<double> dist(0.0, 1.0);
+    vector<Ciphertext> inputs(records);
+    for (auto &ct : inputs)
+    {
+        for (auto &v : input)
+        {
+            v = dist(rng);
+        }
+        Plaintext plain;
+        encoder.encode(input, scale, plain);
+        encryptor.encrypt(plain, ct);
+    }
+
+    Plaintext plain_con1, plain_con2;
+    encoder.encode(1.0, scale, plain_con1);
+    encoder.encode(2.0, context.first_context_data()->next_context_data()->parms_id(), scale, plain_con2);
+
+    // (x+1)^2 (x^2+2): 연산마다 worker pool 전달
+    BatchExecutor::Circuit circuit = [&](const Ciphertext &x, Ciphertext &result, BatchExecutor::Worker &w) {
+        Evaluator &evaluator = w.evaluator;
+        Ciphertext xplus1(w.pool), xplus1_square(w.pool), x_square(w.pool);
+        evaluator.add_plain(x, plain_con1, xplus1);
+        evaluator.square(xplus1, xplus1_square, w.pool);
+        evaluator.relinearize_inplace(xplus1_square, relin_keys, w.pool);
+        evaluator.rescale_to_next_inplace(xplus1_square, w.pool);
+        evaluator.square(x, x_square, w.pool);
+        evaluator.relinearize_inplace(x_square, relin_keys, w.pool);
+        evaluator.rescale_to_next_inplace(x_square, w.pool);
+        x_square.scale() = scale;
+        evaluator.add_plain_inplace(x_square, plain_con2);
+        evaluator.multiply(xplus1_square, x_square, result, w.pool);
+        evaluator.relinearize_inplace(result, relin_keys, w.pool);
+        evaluator.rescale_to_next_inplace(result, w.pool);
+    };
+
+    cout << setw(8) << "threads" << setw(12) << "median(s)" << setw(14) << "records/s" << setw(10) << "speedup"
+         << setw(12) << "efficiency" << setw(10) << "steals" << endl;
+    double base = 0;
+    for (size_t threads : thread_counts())
+    {
+        BatchExecutor executor(context, threads);
+        vector<Ciphertext> outputs;
+        vector<double> samples;
+        for (size_t r = 0; r < reps; r++)
+        {
+            auto start = chrono::steady_clock::now();
+            executor.run(inputs, outputs, circuit);
+            samples.push_back(chrono::duration<double>(chrono::steady_clock::now() - start).count());
+        }
+        double seconds = bench::summarize(samples).medianUs;
+        double throughput = records / seconds;
+        if (base == 0)
+        {
+            base = throughput;
+        }
+        cout << setw(8) << threads << fixed << setprecision(3) << setw(12) << seconds << setprecision(1) << setw(14)
+             << throughput << setprecision(2) << setw(9) << throughput / base << "x" << setw(11)
+             << 100 * throughput / base / threads << "%" << setw(10) << executor.steal_count() << defaultfloat
+             << endl;
+    }
+    return 0;
+}
@@ -0,0 +1,132 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+/*
+  Ciphertext container benchmark (SEAL)
+  full(encrypt) / seeded(encrypt_symmetric) × 압축 없음 / zstd 조합으로 암호문 N개를 저장, 불러와서
+  암호문당 크기, 저장/불러오기 처리량(GB/s), 임의 위치 record 1개 불러오기 지연시간 출력
+ */
+
+#include "seal/seal.h"
+#include "seal-container.h"
+#include "bench-util.h"
+#include <cstdio>
+#include <random>
+
+using namespace std;
+using namespace seal;
+
+// 사용법: seal_container_bench [--count 256] [--reps 3] [--path /tmp/seal.ckct]
+int main(int argc, char *argv[])
+{
+    size_t count = 256;
+    size_t reps = 3;
+    string path = "seal-bench.ckct";
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg == "--count" && i + 1 < argc)
+            count = stoul(argv[++i]);
+        else if (arg == "--reps" && i + 1 < argc)
+            reps = stoul(argv[++i]);
+        else if (arg == "--path" && i + 1 < argc)
+            path = argv[++i];
+    }
+
+    EncryptionParameters parms(scheme_type::ckks);
+    size_t poly_modulus_degree = 16384;
+    parms.set_poly_modulus_degree(poly_modulus_degree);
+    parms.set_coeff_modulus(CoeffModulus::Create(poly_modulus_degree, { 60, 50, 50, 50, 50, 60 }));
+    double scale = pow(2.0, 50);
+
+    SEALContext context(parms);
+    KeyGenerator keygen(context);
+    PublicKey public_key;
+    keygen.create_public_key(public_key);
+    Encryptor encryptor(context, public_key, keygen.secret_key());
+    CKKSEncoder encoder(context);
+
+    vector<double> input(encoder.slot_count());
+    mt19937_64 rng(42);
+    uniform_real_distribution<double> dist(-1.0, 1.0);
+    for (auto &v : input)
+    {
+        v = dist(rng);
+    }
+    Plaintext plain;
+    encoder.encode(input, scale, plain);
+
+    vector<Ciphertext> full(count);
+    for (auto &ct : full)
+    {
+        encryptor.encrypt(plain, ct);
+    }
+    vector<Serializable<Ciphertext>> seeded;
+    seeded.reserve(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        seeded.push_back(encryptor.encrypt_symmetric(plain));
+    }
+
+    auto seconds = [](chrono::steady_clock::time_point start) {
+        return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    };
+
+    cout << count << " ciphertexts, poly_modulus_degree " << poly_modulus_degree << endl;
+    cout << setw(8) << "format" << setw(6) << "zstd" << setw(14) << "bytes/ct" << setw(12) << "save GB/s"
+         << setw(12) << "load GB/s" << setw(16) << "random load(us)" << endl;
+
+    for (bool use_seed : { false, true })
+    {
+        for (int level : { 0, 3 })
+        {
+            if (level > 0 && !lbcrypto::CiphertextContainer::zstdAvailable())
+            {
+                continue;
+            }
+            vector<double> save_s, load_s, random_us;
+            size_t file_size = 0;
+            for (size_t r = 0; r < reps; r++)
+            {
+                auto start = chrono::steady_clock::now();
+                {
+                    lbcrypto::ContainerWriter writer(path, lbcrypto::CONTAINER_SEAL, level);
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        if (use_seed)
+                            append_ciphertext(writer, seeded[i]);
+                        else
+                            append_ciphertext(writer, full[i]);
+                    }
+                }
+                save_s.push_back(seconds(start));
+
+                start = chrono::steady_clock::now();
+                lbcrypto::ContainerReader reader(path);
+                vector<char> scratch;
+                Ciphertext loaded;
+                for (size_t i = 0; i < reader.size(); i++)
+                {
+                    load_ciphertext(reader, i, context, loaded, scratch);
+                }
+                load_s.push_back(seconds(start));
+                file_size = reader.getFileSize();
+
+                uniform_int_distribution<size_t> pick(0, count - 1);
+                for (int k = 0; k < 16; k++)
+                {
+                    start = chrono::steady_clock::now();
+                    load_ciphertext(reader, pick(rng), context, loaded, scratch);
+                    random_us.push_back(seconds(start) * 1e6);
+                }
+            }
+            double gb = file_size / 1e9;
+            cout << setw(8) << (use_seed ? "seeded" : "full") << setw(6) << level << setw(14) << file_size / count
+                 << fixed << setprecision(2) << setw(12) << gb / bench::summarize(save_s).medianUs << setw(12)
+                 << gb / bench::summarize(load_s).medianUs << setprecision(1) << setw(16)
+                 << bench::summarize(random_us).medianUs << defaultfloat << endl;
+        }
+    }
+    remove(path.c_str());
+    return 0;
+}
@@ -0,0 +1,88 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+/*
+  Galois key 생성 비교: create_galois_keys() (모든 2의 거듭제곱 step) vs
+  회로가 실제로 사용하는 step만 생성 (TraceableCiphertext가 저장한 rotation-steps.txt)
+ */
+
+#include "seal/seal.h"
+#include "bench-util.h"
+#include "rotation-steps.h"
+#include <chrono>
+#include <sstream>
+
+using namespace std;
+using namespace seal;
+
+// 사용법: seal_galois_keygen_bench [--steps-file rotation-steps.txt | --steps 2,3] [--logn 14]
+int main(int argc, char *argv[])
+{
+    lbcrypto::RotationSteps steps;
+    uint32_t log_n = 14;
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg == "--steps-file" && i + 1 < argc)
+        {
+            if (!steps.load(argv[++i]))
+            {
+                cout << "Cannot read " << argv[i] << endl;
+                return 1;
+            }
+        }
+        else if (arg == "--steps" && i + 1 < argc)
+        {
+            stringstream ss(argv[++i]);
+            string item;
+            while (getline(ss, item, ','))
+            {
+                steps.add(stoi(item));
+            }
+        }
+        else if (arg == "--logn" && i + 1 < argc)
+        {
+            log_n = stoul(argv[++i]);
+        }
+    }
+    if (steps.empty())
+    {
+        steps.add(2);   // my_ckks_prac의 left rotation 2
+    }
+
+    EncryptionParameters parms(scheme_type::ckks);
+    size_t poly_modulus_degree = size_t(1) << log_n;
+    parms.set_poly_modulus_degree(poly_modulus_degree);
+    parms.set_coeff_modulus(CoeffModulus::Create(poly_modulus_degree, { 60, 50, 50, 50, 50, 60 }));
+    SEALContext context(parms);
+    KeyGenerator keygen(context);
+
+    using Clock = chrono::steady_clock;
+    Clock::time_point t0 = Clock::now();
+    GaloisKeys all_keys;
+    keygen.create_galois_keys(all_keys);
+    double all_ms = chrono::duration<double, milli>(Clock::now() - t0).count();
+
+    t0 = Clock::now();
+    GaloisKeys min_keys;
+    keygen.create_galois_keys(steps.toSealSteps(), min_keys);
+    double min_ms = chrono::duration<double, milli>(Clock::now() - t0).count();
+
+    // 메모리 크기는 압축하지 않은 직렬화 크기로 근사
+    double all_mb = all_keys.save_size(compr_mode_type::none) / (1024.0 * 1024.0);
+    double min_mb = min_keys.save_size(compr_mode_type::none) / (1024.0 * 1024.0);
+
+    cout << "poly_modulus_degree: " << poly_modulus_degree << ", steps used by circuit:";
+    for (int step : steps.toSealSteps())
+    {
+        cout << " " << step;
+    }
+    cout << endl;
+    cout << fixed << setprecision(2);
+    cout << "    + all power-of-two steps: " << all_keys.size() << " keys, " << all_mb << " MB, " << all_ms << " ms"
+         << endl;
+    cout << "    + circuit steps only    : " << min_keys.size() << " keys, " << min_mb << " MB, " << min_ms << " ms"
+         << endl;
+    cout << "    + saved                 : " << all_mb - min_mb << " MB, " << all_ms - min_ms << " ms" << endl;
+    return 0;
+}
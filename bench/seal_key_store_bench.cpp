@@ -0,0 +1,104 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+/*
+  Galois key store benchmark (SEAL)
+  step 1..N의 Galois key를 디스크에 두고, 앞쪽 step에 치우친 rotation 요청을 메모리 상한별로 실행
+  모든 키를 메모리에 둔 경우와 rotation당 시간, hit rate, load 지연시간, 최대 상주 메모리 비교
+ */
+
+#include "seal/seal.h"
+#include "seal-galois-key-store.h"
+#include "bench-util.h"
+#include <random>
+
+using namespace std;
+using namespace seal;
+
+// 사용법: seal_key_store_bench [--steps 32] [--rotations 512] [--dir seal-galois-keys]
+int main(int argc, char *argv[])
+{
+    int num_steps = 32;
+    size_t rotations = 512;
+    string dir = "seal-galois-keys";
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg == "--steps" && i + 1 < argc)
+            num_steps = stoi(argv[++i]);
+        else if (arg == "--rotations" && i + 1 < argc)
+            rotations = stoul(argv[++i]);
+        else if (arg == "--dir" && i + 1 < argc)
+            dir = argv[++i];
+    }
+
+    EncryptionParameters parms(scheme_type::ckks);
+    size_t poly_modulus_degree = 16384;
+    parms.set_poly_modulus_degree(poly_modulus_degree);
+    parms.set_coeff_modulus(CoeffModulus::Create(poly_modulus_degree, { 60, 50, 50, 50, 50, 60 }));
+    double scale = pow(2.0, 50);
+
+    SEALContext context(parms);
+    KeyGenerator keygen(context);
+    PublicKey public_key;
+    keygen.create_public_key(public_key);
+    Encryptor encryptor(context, public_key);
+    Evaluator evaluator(context);
+    CKKSEncoder encoder(context);
+
+    vector<int> steps;
+    for (int step = 1; step <= num_steps; step++)
+    {
+        steps.push_back(step);
+    }
+    GaloisKeyStore::generate(keygen, steps, dir);
+
+    // 요청의 80%는 앞쪽 20% step (회로의 inner loop), 나머지는 전체에서 고름
+    vector<int> requests(rotations);
+    mt19937 rng(42);
+    uniform_int_distribution<int> hot(1, max(1, num_steps / 5)), any(1, num_steps);
+    uniform_real_distribution<double> coin(0.0, 1.0);
+    for (auto &step : requests)
+    {
+        step = coin(rng) < 0.8 ? hot(rng) : any(rng);
+    }
+
+    Plaintext plain;
+    encoder.encode(vector<double>(encoder.slot_count(), 0.5), scale, plain);
+    Ciphertext input, rotated;
+    encryptor.encrypt(plain, input);
+
+    auto seconds = [](chrono::steady_clock::time_point start) {
+        return chrono::duration<double>(chrono::steady_clock::now() - start).count();
+    };
+
+    // 기준: 모든 step의 키를 메모리에 둠
+    GaloisKeys all_keys;
+    keygen.create_galois_keys(steps, all_keys);
+    size_t all_bytes = static_cast<size_t>(all_keys.save_size(compr_mode_type::none));
+    auto start = chrono::steady_clock::now();
+    for (int step : requests)
+    {
+        evaluator.rotate_vector(input, step, all_keys, rotated);
+    }
+    double all_ms = 1000 * seconds(start) / rotations;
+
+    cout << num_steps << " steps, " << rotations << " rotations, poly_modulus_degree " << poly_modulus_degree << endl;
+    cout << fixed << setprecision(2);
+    cout << "    + all keys in memory: " << all_ms << " ms/rotation, " << all_bytes / (1024.0 * 1024.0) << " MB"
+         << endl;
+    for (double fraction : { 1.0, 0.5, 0.25, 0.1 })
+    {
+        GaloisKeyStore store(context, dir, static_cast<size_t>(fraction * all_bytes));
+        start = chrono::steady_clock::now();
+        for (int step : requests)
+        {
+            store.rotate_vector(evaluator, input, step, rotated);
+        }
+        double ms = 1000 * seconds(start) / rotations;
+        cout << "    + store cap " << setw(3) << static_cast<int>(100 * fraction) << "%: " << ms << " ms/rotation"
+             << endl;
+        lbcrypto::printKeyCacheStats("      key store", store.stats());
+    }
+    return 0;
+}
@@ -0,0 +1,158 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+/*
+  Lazy relinearization benchmark (SEAL)
+  내적 형태 회로 sum_i a_i * b_i 를
+  - eager: 곱셈마다 relinearize + rescale (5_ckks_basics.cpp 방식)
+  - AutoEvaluator: rescale만 지연
+  - AutoEvaluator + lazy relinearization: 크기 3 암호문을 더한 뒤 relinearize 1번
+  으로 계산해서 key switching(relinearize) 횟수, rescale 횟수, 지연시간, 최대 오차 비교
+ */
+
+#include "seal/seal.h"
+#include "seal-auto-evaluator.h"
+#include "bench-util.h"
+#include <functional>
+#include <random>
+
+using namespace std;
+using namespace seal;
+
+// 사용법: seal_lazy_relin_bench [--terms 32] [--reps 10]
+int main(int argc, char *argv[])
+{
+    size_t max_terms = 32;
+    size_t reps = 10;
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg == "--terms" && i + 1 < argc)
+            max_terms = stoul(argv[++i]);
+        else if (arg == "--reps" && i + 1 < argc)
+            reps = stoul(argv[++i]);
+    }
+
+    EncryptionParameters parms(scheme_type::ckks);
+    size_t poly_modulus_degree = 16384;
+    parms.set_poly_modulus_degree(poly_modulus_degree);
+    parms.set_coeff_modulus(CoeffModulus::Create(poly_modulus_degree, { 60, 40, 40, 40, 60 }));
+    double scale = pow(2.0, 40);
+
+    SEALContext context(parms);
+    KeyGenerator keygen(context);
+    auto secret_key = keygen.secret_key();
+    PublicKey public_key;
+    keygen.create_public_key(public_key);
+    RelinKeys relin_keys;
+    keygen.create_relin_keys(relin_keys);
+    Encryptor encryptor(context, public_key);
+    Evaluator evaluator(context);
+    Decryptor decryptor(context, secret_key);
+    CKKSEncoder encoder(context);
+
+    cout << "CKKS scheme is using poly_modulus_degree " << poly_modulus_degree << endl << endl;
+
+    size_t slot_count = encoder.slot_count();
+    mt19937_64 rng(42);
+    uniform_real_distribution<double> dist(-1.0, 1.0);
+    vector<vector<double>> a(max_terms, vector<double>(slot_count)), b(max_terms, vector<double>(slot_count));
+    vector<Ciphertext> a_encrypted(max_terms), b_encrypted(max_terms);
+    for (size_t t = 0; t < max_terms; t++)
+    {
+        for (size_t i = 0; i < slot_count; i++)
+        {
+            a[t][i] = dist(rng);
+            b[t][i] = dist(rng);
+        }
+        Plaintext plain;
+        encoder.encode(a[t], scale, plain);
+        encryptor.encrypt(plain, a_encrypted[t]);
+        encoder.encode(b[t], scale, plain);
+        encryptor.encrypt(plain, b_encrypted[t]);
+    }
+
+    cout << setw(6) << "terms" << setw(14) << "mode" << setw(8) << "relins" << setw(10) << "rescales" << setw(12)
+         << "median(ms)" << setw(12) << "max err" << endl;
+
+    for (size_t terms = 2; terms <= max_terms; terms *= 2)
+    {
+        vector<double> expected(slot_count, 0.0);
+        for (size_t t = 0; t < terms; t++)
+        {
+            for (size_t i = 0; i < slot_count; i++)
+            {
+                expected[i] += a[t][i] * b[t][i];
+            }
+        }
+
+        auto report = [&](const string &mode, size_t relins, size_t rescales, const vector<double> &samples,
+                          const Ciphertext &out) {
+            Plaintext plain_result;
+            decryptor.decrypt(out, plain_result);
+            vector<double> result;
+            encoder.decode(plain_result, result);
+            double err = 0;
+            for (size_t i = 0; i < slot_count; i++)
+            {
+                err = max(err, fabs(result[i] - expected[i]));
+            }
+            cout << setw(6) << terms << setw(14) << mode << setw(8) << relins << setw(10) << rescales << fixed
+                 << setprecision(2) << setw(12) << bench::summarize(samples).medianUs << scientific << setprecision(2)
+                 << setw(12) << err << defaultfloat << endl;
+        };
+
+        auto time_ms = [](const function<void()> &fn) {
+            auto start = chrono::steady_clock::now();
+            fn();
+            return chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+        };
+
+        // eager: 곱셈마다 relinearize, rescale
+        vector<double> samples;
+        Ciphertext out;
+        for (size_t r = 0; r < reps; r++)
+        {
+            samples.push_back(time_ms([&]() {
+                for (size_t t = 0; t < terms; t++)
+                {
+                    Ciphertext product;
+                    evaluator.multiply(a_encrypted[t], b_encrypted[t], product);
+                    evaluator.relinearize_inplace(product, relin_keys);
+                    evaluator.rescale_to_next_inplace(product);
+                    if (t == 0)
+                        out = product;
+                    else
+                        evaluator.add_inplace(out, product);
+                }
+            }));
+        }
+        report("eager", terms, terms, samples, out);
+
+        for (bool lazy : { false, true })
+        {
+            AutoEvaluator auto_evaluator(context, encoder, evaluator, relin_keys, scale);
+            auto_evaluator.set_lazy_relinearization(lazy);
+            samples.clear();
+            for (size_t r = 0; r < reps; r++)
+            {
+                auto_evaluator.reset_stats();
+                samples.push_back(time_ms([&]() {
+                    for (size_t t = 0; t < terms; t++)
+                    {
+                        Ciphertext product;
+                        auto_evaluator.multiply(a_encrypted[t], b_encrypted[t], product);
+                        if (t == 0)
+                            out = product;
+                        else
+                            auto_evaluator.add_inplace(out, product);
+                    }
+                    auto_evaluator.finalize(out);
+                }));
+            }
+            const AutoEvaluatorStats &stats = auto_evaluator.stats();
+            report(lazy ? "lazy relin" : "lazy rescale", stats.relinearizations, stats.rescales, samples, out);
+        }
+    }
+    return 0;
+}
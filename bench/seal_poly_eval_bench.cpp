@@ -0,0 +1,202 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+/*
+  SEAL CKKS polynomial evaluation benchmark
+  PolyEvaluator + SEALPolyBackend(task3)를 직접 작성한 회로(5_ckks_basics의 PI*x^3 + 0.4x + 1,
+  my_ckks_prac의 (x+1)^2(x^2+2))와 비교하고, 차수 3 ~ 63의 임의 계수 다항식에 대해
+  소모 레벨, 암호문 곱셈 수, 지연시간, 최대 오차 출력
+ */
+
+#include "seal/seal.h"
+#include "seal-poly-backend.h"
+#include "bench-util.h"
+#include <functional>
+#include <random>
+
+using namespace std;
+using namespace seal;
+
+double horner(const vector<double> &coeffs, double x)
+{
+    double y = 0;
+    for (size_t i = coeffs.size(); i-- > 0;)
+    {
+        y = y * x + coeffs[i];
+    }
+    return y;
+}
+
+// 사용법: seal_poly_eval_bench [--reps 5] [--max-degree 63]
+int main(int argc, char *argv[])
+{
+    size_t reps = 5;
+    size_t max_degree = 63;
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg == "--reps" && i + 1 < argc)
+            reps = stoul(argv[++i]);
+        else if (arg == "--max-degree" && i + 1 < argc)
+            max_degree = stoul(argv[++i]);
+    }
+
+    // degree 63을 depth 6(slack 1이면 7)으로 평가하기 위해 40비트 소수 7개
+    EncryptionParameters parms(scheme_type::ckks);
+    size_t poly_modulus_degree = 16384;
+    parms.set_poly_modulus_degree(poly_modulus_degree);
+    parms.set_coeff_modulus(CoeffModulus::Create(poly_modulus_degree, { 60, 40, 40, 40, 40, 40, 40, 40, 60 }));
+    double scale = pow(2.0, 40);
+
+    SEALContext context(parms);
+    KeyGenerator keygen(context);
+    auto secret_key = keygen.secret_key();
+    PublicKey public_key;
+    keygen.create_public_key(public_key);
+    RelinKeys relin_keys;
+    keygen.create_relin_keys(relin_keys);
+    Encryptor encryptor(context, public_key);
+    Evaluator evaluator(context);
+    Decryptor decryptor(context, secret_key);
+    CKKSEncoder encoder(context);
+
+    cout << "CKKS scheme is using poly_modulus_degree " << poly_modulus_degree << endl << endl;
+
+    vector<double> input(encoder.slot_count());
+    mt19937_64 rng(42);
+    uniform_real_distribution<double> dist(-1.0, 1.0);
+    for (auto &v : input)
+    {
+        v = dist(rng);
+    }
+    Plaintext x_plain;
+    encoder.encode(input, scale, x_plain);
+    Ciphertext x1_encrypted;
+    encryptor.encrypt(x_plain, x1_encrypted);
+
+    SEALPolyBackend backend(context, encoder, evaluator, relin_keys, scale);
+    lbcrypto::PolyEvaluator<SEALPolyBackend> poly(backend);
+    size_t top_level = context.first_context_data()->chain_index();
+
+    auto measure = [&](const string &name, size_t degree, uint32_t ct_mults, const vector<double> &coeffs,
+                       const function<Ciphertext()> &circuit) {
+        vector<double> samples;
+        Ciphertext out;
+        for (size_t r = 0; r < reps; r++)
+        {
+            auto start = chrono::steady_clock::now();
+            out = circuit();
+            backend.finalize(out);  // PolyEvaluator 결과는 rescale 대기 중일 수 있음. 직접 작성한 회로에는 영향 없음
+            samples.push_back(chrono::duration<double, milli>(chrono::steady_clock::now() - start).count());
+        }
+        Plaintext plain_result;
+        decryptor.decrypt(out, plain_result);
+        vector<double> result;
+        encoder.decode(plain_result, result);
+        double err = 0;
+        for (size_t i = 0; i < input.size(); i++)
+        {
+            err = max(err, fabs(result[i] - horner(coeffs, input[i])));
+        }
+        size_t levels = top_level - context.get_context_data(out.parms_id())->chain_index();
+        cout << setw(28) << left << name << right << setw(7) << degree << setw(8) << levels << setw(9) << ct_mults
+             << fixed << setprecision(2) << setw(12) << bench::summarize(samples).medianUs << scientific
+             << setprecision(2) << setw(12) << err << defaultfloat << endl;
+    };
+
+    cout << setw(28) << left << "circuit" << right << setw(7) << "degree" << setw(8) << "levels" << setw(9)
+         << "ctMults" << setw(12) << "median(ms)" << setw(12) << "max err" << endl;
+
+    // 5_ckks_basics.cpp의 회로
+    const vector<double> cubic{ 1.0, 0.4, 0.0, 3.14159265 };
+    measure("hand: PI*x^3+0.4x+1", 3, 2, cubic, [&]() {
+        Plaintext plain_coeff3, plain_coeff1, plain_coeff0;
+        encoder.encode(3.14159265, scale, plain_coeff3);
+        encoder.encode(0.4, scale, plain_coeff1);
+        encoder.encode(1.0, scale, plain_coeff0);
+
+        Ciphertext x3_encrypted;
+        evaluator.square(x1_encrypted, x3_encrypted);
+        evaluator.relinearize_inplace(x3_encrypted, relin_keys);
+        evaluator.rescale_to_next_inplace(x3_encrypted);
+
+        Ciphertext x1_encrypted_coeff3;
+        evaluator.multiply_plain(x1_encrypted, plain_coeff3, x1_encrypted_coeff3);
+        evaluator.rescale_to_next_inplace(x1_encrypted_coeff3);
+
+        evaluator.multiply_inplace(x3_encrypted, x1_encrypted_coeff3);
+        evaluator.relinearize_inplace(x3_encrypted, relin_keys);
+        evaluator.rescale_to_next_inplace(x3_encrypted);
+
+        Ciphertext x1_coeff1;
+        evaluator.multiply_plain(x1_encrypted, plain_coeff1, x1_coeff1);
+        evaluator.rescale_to_next_inplace(x1_coeff1);
+
+        x3_encrypted.scale() = pow(2.0, 40);
+        x1_coeff1.scale() = pow(2.0, 40);
+        parms_id_type last_parms_id = x3_encrypted.parms_id();
+        evaluator.mod_switch_to_inplace(x1_coeff1, last_parms_id);
+        evaluator.mod_switch_to_inplace(plain_coeff0, last_parms_id);
+
+        Ciphertext encrypted_result;
+        evaluator.add(x3_encrypted, x1_coeff1, encrypted_result);
+        evaluator.add_plain_inplace(encrypted_result, plain_coeff0);
+        return encrypted_result;
+    });
+    measure("PolyEvaluator: PI*x^3+0.4x+1", 3,
+            lbcrypto::PolyEvaluator<lbcrypto::SymbolicPolyBackend>::plan(cubic).second.ctMults, cubic,
+            [&]() { return poly.evaluate(x1_encrypted, cubic); });
+
+    // my_ckks_prac.cpp의 회로: (x+1)^2 (x^2+2) = x^4 + 2x^3 + 3x^2 + 4x + 2
+    const vector<double> quartic{ 2.0, 4.0, 3.0, 2.0, 1.0 };
+    measure("hand: (x+1)^2(x^2+2)", 4, 3, quartic, [&]() {
+        Plaintext plain_one, plain_two;
+        encoder.encode(1.0, scale, plain_one);
+        Ciphertext x_plus_one, x_plus_one_sq, x_sq;
+        evaluator.add_plain(x1_encrypted, plain_one, x_plus_one);
+        evaluator.square(x_plus_one, x_plus_one_sq);
+        evaluator.relinearize_inplace(x_plus_one_sq, relin_keys);
+        evaluator.rescale_to_next_inplace(x_plus_one_sq);
+
+        evaluator.square(x1_encrypted, x_sq);
+        evaluator.relinearize_inplace(x_sq, relin_keys);
+        evaluator.rescale_to_next_inplace(x_sq);
+        encoder.encode(2.0, x_sq.parms_id(), x_sq.scale(), plain_two);
+        evaluator.add_plain_inplace(x_sq, plain_two);
+
+        x_sq.scale() = x_plus_one_sq.scale();
+        Ciphertext encrypted_result;
+        evaluator.multiply(x_plus_one_sq, x_sq, encrypted_result);
+        evaluator.relinearize_inplace(encrypted_result, relin_keys);
+        evaluator.rescale_to_next_inplace(encrypted_result);
+        return encrypted_result;
+    });
+    measure("PolyEvaluator: expanded", 4,
+            lbcrypto::PolyEvaluator<lbcrypto::SymbolicPolyBackend>::plan(quartic).second.ctMults, quartic,
+            [&]() { return poly.evaluate(x1_encrypted, quartic); });
+    measure("PolyEvaluator: factored", 4, 3, quartic, [&]() {
+        return poly.evaluateFactored(x1_encrypted, { { 1.0, 1.0 }, { 1.0, 1.0 }, { 2.0, 0.0, 1.0 } });
+    });
+
+    // 임의 계수 다항식
+    for (size_t degree : { 3, 5, 7, 15, 31, 63 })
+    {
+        if (degree > max_degree)
+        {
+            break;
+        }
+        vector<double> coeffs(degree + 1);
+        for (auto &v : coeffs)
+        {
+            v = dist(rng);
+        }
+        for (uint32_t slack : { 0u, 1u })
+        {
+            auto planned = lbcrypto::PolyEvaluator<lbcrypto::SymbolicPolyBackend>::plan(coeffs, slack);
+            measure(
+                "PolyEvaluator slack " + to_string(slack), degree, planned.second.ctMults, coeffs,
+                [&]() { return poly.evaluate(x1_encrypted, coeffs, slack); });
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,133 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+/*
+  SEAL CKKS 기본 연산별 마이크로벤치마크
+  encode, encrypt, add, add_plain, multiply, relinearize, rescale, mod_switch, rotate, decrypt, decode를
+  ring dimension(2^13 ~ 2^15)과 레벨(chain index)별로 측정
+ */
+
+#include "seal/seal.h"
+#include "bench-util.h"
+#include <random>
+
+using namespace std;
+using namespace seal;
+
+void bench_ring(bench::Runner &runner, uint32_t log_n, bool all_levels)
+{
+    size_t poly_modulus_degree = size_t(1) << log_n;
+    if (log_n > 15)
+    {
+        cout << "SEAL supports poly_modulus_degree up to 2^15. Skipping 2^" << log_n << endl;
+        return;
+    }
+
+    // {60, 40, ..., 40, 60}: 128-bit 보안에서 허용되는 최대 개수의 40비트 소수
+    int max_bits = CoeffModulus::MaxBitCount(poly_modulus_degree);
+    vector<int> bit_sizes{ 60 };
+    for (int i = 0; i < (max_bits - 120) / 40; i++)
+    {
+        bit_sizes.push_back(40);
+    }
+    bit_sizes.push_back(60);
+
+    EncryptionParameters parms(scheme_type::ckks);
+    parms.set_poly_modulus_degree(poly_modulus_degree);
+    parms.set_coeff_modulus(CoeffModulus::Create(poly_modulus_degree, bit_sizes));
+    double scale = pow(2.0, 40);
+
+    SEALContext context(parms);
+    KeyGenerator keygen(context);
+    auto secret_key = keygen.secret_key();
+    PublicKey public_key;
+    keygen.create_public_key(public_key);
+    RelinKeys relin_keys;
+    keygen.create_relin_keys(relin_keys);
+    GaloisKeys gal_keys;
+    keygen.create_galois_keys(vector<int>{ 1 }, gal_keys);  // rotate 측정에 필요한 step 1만 생성
+    Encryptor encryptor(context, public_key);
+    Evaluator evaluator(context);
+    Decryptor decryptor(context, secret_key);
+    CKKSEncoder encoder(context);
+
+    vector<double> input(encoder.slot_count());
+    mt19937_64 rng(42);
+    uniform_real_distribution<double> dist(-1.0, 1.0);
+    for (auto &v : input)
+    {
+        v = dist(rng);
+    }
+
+    size_t top_level = context.first_context_data()->chain_index();
+    for (auto context_data = context.first_context_data(); context_data && context_data->chain_index() >= 1;
+         context_data = context_data->next_context_data())
+    {
+        uint32_t level = static_cast<uint32_t>(context_data->chain_index());
+        // 기본은 최상위, 중간, 최하위(1) 레벨만 측정
+        if (!all_levels && level != top_level && level != (top_level + 1) / 2 && level != 1)
+        {
+            continue;
+        }
+        parms_id_type parms_id = context_data->parms_id();
+
+        Plaintext pt, pt_out;
+        encoder.encode(input, parms_id, scale, pt);
+        Ciphertext ct1, ct2, ct_size3, ct_relin, out;
+        encryptor.encrypt(pt, ct1);
+        encryptor.encrypt(pt, ct2);
+        evaluator.multiply(ct1, ct2, ct_size3);
+        evaluator.relinearize(ct_size3, relin_keys, ct_relin);
+        vector<double> decoded;
+
+        runner.run("SEAL", "encode", log_n, level, [&]() { encoder.encode(input, parms_id, scale, pt_out); });
+        runner.run("SEAL", "encrypt", log_n, level, [&]() { encryptor.encrypt(pt, out); });
+        runner.run("SEAL", "add", log_n, level, [&]() { evaluator.add(ct1, ct2, out); });
+        runner.run("SEAL", "add_plain", log_n, level, [&]() { evaluator.add_plain(ct1, pt, out); });
+        runner.run("SEAL", "multiply", log_n, level, [&]() { evaluator.multiply(ct1, ct2, out); });
+        runner.run("SEAL", "relinearize", log_n, level, [&]() { evaluator.relinearize(ct_size3, relin_keys, out); });
+        runner.run("SEAL", "rescale", log_n, level, [&]() { evaluator.rescale_to_next(ct_relin, out); });
+        runner.run("SEAL", "mod_switch", log_n, level, [&]() { evaluator.mod_switch_to_next(ct1, out); });
+        runner.run("SEAL", "rotate", log_n, level, [&]() { evaluator.rotate_vector(ct1, 1, gal_keys, out); });
+        runner.run("SEAL", "decrypt", log_n, level, [&]() { decryptor.decrypt(ct1, pt_out); });
+        runner.run("SEAL", "decode", log_n, level, [&]() { encoder.decode(pt, decoded); });
+    }
+}
+
+// 사용법: seal_primitives_bench [--logn 13-15] [--reps 10] [--all-levels] [--csv out.csv]
+int main(int argc, char *argv[])
+{
+    pair<uint32_t, uint32_t> log_n_range{ 13, 15 };
+    size_t reps = 10;
+    bool all_levels = false;
+    string csv_path;
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if (arg == "--logn" && i + 1 < argc)
+            log_n_range = bench::parseRange(argv[++i]);
+        else if (arg == "--reps" && i + 1 < argc)
+            reps = stoul(argv[++i]);
+        else if (arg == "--all-levels")
+            all_levels = true;
+        else if (arg == "--csv" && i + 1 < argc)
+            csv_path = argv[++i];
+    }
+
+    bench::Runner runner(reps);
+    if (!runner.countersAvailable())
+    {
+        cout << "perf_event_open unavailable (check /proc/sys/kernel/perf_event_paranoid): hardware counters disabled"
+             << endl;
+    }
+    bench::Runner::printHeader();
+    for (uint32_t log_n = log_n_range.first; log_n <= log_n_range.second; log_n++)
+    {
+        bench_ring(runner, log_n, all_levels);
+    }
+    if (!csv_path.empty())
+    {
+        runner.writeCsv(csv_path);
+    }
+    return 0;
+}
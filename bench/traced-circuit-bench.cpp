@@ -0,0 +1,140 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Same traced circuit on SEAL and OpenFHE (TracedCiphertext, traced-ciphertext.h)
+  (x+1)^2 (x^2+2)를 계산하고 왼쪽으로 2 회전 (traceable-cipher-test와 같은 회로)를 두 backend에서 같은 코드로 실행
+  - 측정: TRACE_OFF로 회로 전체 latency
+  - 정밀도: PrecisionAnalyzer로 마지막 결과의 모든 슬롯을 평문 계산과 비교
+  두 라이브러리 모두 ring dimension 16384, 스케일 2^50, 곱셈 레벨 3
+ */
+
+#include "openfhe.h"
+#include "openfhe-trace-backend.h"
+#include "seal/seal.h"
+#include "seal-trace-backend.h"
+#include "bench-util.h"
+
+#include <random>
+
+using namespace lbcrypto;
+
+static const int32_t SHIFT = 2;
+
+template <typename Backend>
+static TracedCiphertext<Backend> Circuit(const TracedCiphertext<Backend>& x) {
+    TracedCiphertext<Backend> xPlus1 = x.cipherAdd(1.0);
+    TracedCiphertext<Backend> right  = x.cipherMult(x).cipherAdd(2.0);
+    // 회전 전에 대기 중인 rescale 수행: 두 backend 모두 limb가 하나 적은 암호문을 회전
+    return xPlus1.cipherMult(xPlus1).cipherMult(right).cipherRescale().cipherRotate(SHIFT);
+}
+
+// 회로를 측정하고 정밀도를 출력. 반환값: median latency(us)
+template <typename Backend>
+static double Run(bench::Runner& runner, const std::shared_ptr<Backend>& backend, uint32_t logN,
+                  const std::vector<std::complex<double>>& input) {
+    TracePolicy off;
+    off.mode = TRACE_OFF;
+    TracedCiphertext<Backend> x(backend, input, off);
+    double medianUs = runner.run(Backend::name(), "circuit", logN, 0, [&]() { Circuit(x); }).medianUs;
+
+    auto analyzer = std::make_shared<PrecisionAnalyzer>();
+    x.setPrecisionAnalyzer(analyzer);
+    PrecisionReport report = Circuit(x).analyzePrecision(Backend::name());
+    std::cout << "    + " << Backend::name() << " precision: " << std::fixed << std::setprecision(1)
+              << report.precisionBits << " bits (min), " << report.meanPrecisionBits << " bits (mean)"
+              << std::defaultfloat << std::endl;
+    return medianUs;
+}
+
+// 사용법: traced-circuit-bench [--reps 10]
+int main(int argc, char* argv[]) {
+    size_t reps = 10;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--reps" && i + 1 < argc)
+            reps = std::stoul(argv[++i]);
+    }
+    const uint32_t ringDim = 16384;
+    const uint32_t logN    = 14;
+    const size_t slots     = ringDim / 2;
+
+    std::vector<std::complex<double>> input(slots);
+    std::mt19937_64 rng(42);
+    std::uniform_real_distribution<double> dist(-1.0, 1.0);
+    for (auto& v : input)
+        v = dist(rng);
+
+    bench::Runner runner(reps);
+    bench::Runner::printHeader();
+
+    // OpenFHE
+    CCParams<CryptoContextCKKSRNS> parameters;
+    parameters.SetMultiplicativeDepth(3);
+    parameters.SetScalingModSize(50);
+    parameters.SetFirstModSize(60);
+    parameters.SetScalingTechnique(FLEXIBLEAUTO);
+    parameters.SetRingDim(ringDim);
+    parameters.SetBatchSize(slots);
+    CryptoContext<DCRTPoly> cc = GenCryptoContext(parameters);
+    cc->Enable(PKE);
+    cc->Enable(KEYSWITCH);
+    cc->Enable(LEVELEDSHE);
+    auto keys = cc->KeyGen();
+    cc->EvalMultKeyGen(keys.secretKey);
+    cc->EvalRotateKeyGen(keys.secretKey, {SHIFT});
+    double openfheUs = Run(runner, std::make_shared<OpenFHETraceBackend<DCRTPoly>>(cc, keys), logN, input);
+
+    // SEAL: 같은 modulus chain (60 + 50 * 3 + 60)
+    seal::EncryptionParameters parms(seal::scheme_type::ckks);
+    parms.set_poly_modulus_degree(ringDim);
+    parms.set_coeff_modulus(seal::CoeffModulus::Create(ringDim, {60, 50, 50, 50, 60}));
+    seal::SEALContext context(parms);
+    seal::KeyGenerator keygen(context);
+    seal::PublicKey publicKey;
+    keygen.create_public_key(publicKey);
+    seal::RelinKeys relinKeys;
+    keygen.create_relin_keys(relinKeys);
+    seal::GaloisKeys galoisKeys;
+    keygen.create_galois_keys(std::vector<int>{SHIFT}, galoisKeys);
+    seal::CKKSEncoder encoder(context);
+    seal::Encryptor encryptor(context, publicKey);
+    seal::Decryptor decryptor(context, keygen.secret_key());
+    seal::Evaluator evaluator(context);
+    auto sealBackend = std::make_shared<seal::SEALTraceBackend>(context, encoder, encryptor, decryptor, evaluator,
+                                                                relinKeys, galoisKeys, std::pow(2.0, 50));
+    double sealUs = Run(runner, sealBackend, logN, input);
+
+    std::cout << std::endl
+              << (sealUs < openfheUs ? "SEAL" : "OpenFHE") << " is faster: " << std::fixed << std::setprecision(2)
+              << std::max(sealUs, openfheUs) / std::min(sealUs, openfheUs) << "x" << std::endl;
+    return 0;
+}
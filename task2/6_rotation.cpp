@@ -59,7 +59,7 @@ void example_rotation_bfv() // 행렬의 행을 왼쪽으로 3번 회전시킨 
     cout << endl;
 
     GaloisKeys galois_keys; 
-    keygen.create_galois_keys(galois_keys); // 회전 연산에 필요한 Galois 키를 생성
+    keygen.create_galois_keys(vector<int>{ 3, -4, 0 }, galois_keys); // 회전 연산에 필요한 Galois 키만 생성 (0: 열 회전)
 
     // 암호화된 행렬의 행을 왼쪽으로 세번 회전, 복호화, 디코딩, 출력하는 과정
     
@@ -124,7 +124,7 @@ void example_rotation_ckks() // ckks는 bfv와 매우 유사한 방식으로 회
     RelinKeys relin_keys;
     keygen.create_relin_keys(relin_keys); // 재선형화 키
     GaloisKeys galois_keys;
-    keygen.create_galois_keys(galois_keys); // 갈로아 키
+    keygen.create_galois_keys(vector<int>{ 2 }, galois_keys); // 갈로아 키 (left rotation 2에 필요한 키만 생성)
     Encryptor encryptor(context, public_key);
     Evaluator evaluator(context);
     Decryptor decryptor(context, secret_key);
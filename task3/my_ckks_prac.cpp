@@ -2,12 +2,18 @@
 // Licensed under the MIT license.
 
 #include "examples.h"
+#include "seal-async-evaluator.h"
+#include "seal-auto-evaluator.h"
+#include "seal-budget.h"
+#include "seal-key-snapshot.h"
+#include "seal-memory-scope.h"
 
 using namespace std;
 using namespace seal;
 
 void my_ckks_prac()
 {
+    auto start = chrono::steady_clock::now();
     print_example_banner("THIS IS MY CKKS PRACTICE");
 
     EncryptionParameters parms(scheme_type::ckks);
@@ -22,14 +28,36 @@ void my_ckks_prac()
     print_parameters(context);
     cout << endl;
 
-    KeyGenerator keygen(context);
-    auto secret_key = keygen.secret_key();
+    // 키 생성 전에 아래 회로를 정적 분석: plain_con2를 맨 위 레벨에 인코딩한 채 x^2에 더하면
+    // 복호화하거나 chain_index()를 찍어 보기 전에 레벨, 스케일 불일치가 보고됨
+    {
+        lbcrypto::CircuitBuilder circuit;
+        auto x = circuit.input();
+        auto xplus1_square = circuit.rescale(circuit.square(circuit.addConst(x, 1.0)));
+        auto x_square_plus2 = circuit.addConst(circuit.rescale(circuit.square(x)), 2.0);
+        circuit.rescale(circuit.mult(xplus1_square, x_square_plus2));
+        cout << "Static budget check of (x+1)^2 * (x^2+2) (no keys):" << endl;
+        budget_analyzer(context, scale).analyze(circuit.getNodes()).print(cout, false);
+        cout << endl;
+    }
+
+    // 파라미터가 같으면 이전 실행에서 저장한 키를 불러옴 (KeyGenerator 생략)
+    KeySnapshot snapshot("my_ckks_prac.keys", "galois 2");
+    SecretKey secret_key;
     PublicKey public_key;
-    keygen.create_public_key(public_key);
     RelinKeys relin_keys;
-    keygen.create_relin_keys(relin_keys);
     GaloisKeys gal_keys;
-    keygen.create_galois_keys(gal_keys);
+    bool from_snapshot = snapshot.load(context, secret_key, public_key, relin_keys, gal_keys);
+    if (!from_snapshot)
+    {
+        KeyGenerator keygen(context);
+        secret_key = keygen.secret_key();
+        keygen.create_public_key(public_key);
+        keygen.create_relin_keys(relin_keys);
+        keygen.create_galois_keys(vector<int>{ 2 }, gal_keys);  // 회로에서 쓰는 left rotation 2의 키만 생성
+        snapshot.save(context, secret_key, public_key, relin_keys, gal_keys);
+    }
+    cout << (from_snapshot ? "Keys loaded from " : "Keys generated and saved to ") << snapshot.dir() << endl;
     Encryptor encryptor(context, public_key);
     Evaluator evaluator(context);
     Decryptor decryptor(context, secret_key);
@@ -65,6 +93,8 @@ void my_ckks_prac()
 
     Ciphertext xplus1;
     evaluator.add_plain(x_encrypted, plain_con1, xplus1);   // xplus1 = (x+1) -> lv4
+    cout << "Time to first op: " << chrono::duration<double, milli>(chrono::steady_clock::now() - start).count()
+         << " ms (" << (from_snapshot ? "snapshot" : "keygen") << ")" << endl;
 
     Ciphertext xplus1_square;
     print_line(__LINE__);
@@ -159,4 +189,64 @@ void my_ckks_prac()
     encoder.decode(plain_result, result);
     print_vector(result, 3, 7);
 
+    // 같은 회로를 AutoEvaluator로: scale() 덮어쓰기, mod_switch_to_inplace 없이 자동으로 레벨과 스케일을 맞춤
+    print_line(__LINE__);
+    cout << "Evaluate (x+1)^2 * (x^2+2) again with AutoEvaluator." << endl;
+    AutoEvaluator auto_evaluator(context, encoder, evaluator, relin_keys, scale);
+    ConstantCache constants(encoder);   // 상수 1, 2는 레벨별로 한 번만 인코딩
+    auto_evaluator.set_constant_cache(&constants);
+    // MemoryScope는 process 전역: 블록을 나가면 원래 profile로 돌아가므로 아래 AsyncEvaluator worker의 할당은 arena에 들어가지 않음
+    {
+        // 회로의 임시 암호문과 Evaluator 내부 할당은 전용 arena에서. 두 번째 실행은 첫 실행의 버퍼를 재사용
+        MemoryScope arena;
+        Ciphertext auto_xplus1 = arena.acquire(), auto_xplus1_square = arena.acquire(), auto_x_square = arena.acquire(),
+                   auto_x_square_plus2 = arena.acquire(), auto_result = arena.acquire();
+        for (int run = 0; run < 2; run++)   // 두 번째 실행은 캐시된 상수 사용
+        {
+            auto_evaluator.reset_stats();
+            arena.reset_stats();
+            arena.track("add_const(x, 1)", [&] { auto_evaluator.add_const(x_encrypted, 1.0, auto_xplus1); });
+            arena.track("square(x+1)", [&] { auto_evaluator.square(auto_xplus1, auto_xplus1_square); });
+            arena.track("square(x)", [&] { auto_evaluator.square(x_encrypted, auto_x_square); });
+            arena.track(
+                "add_const(x^2, 2)", [&] { auto_evaluator.add_const(auto_x_square, 2.0, auto_x_square_plus2); });
+            arena.track(
+                "multiply", [&] { auto_evaluator.multiply(auto_xplus1_square, auto_x_square_plus2, auto_result); });
+            arena.track("finalize", [&] { auto_evaluator.finalize(auto_result); });
+            cout << "    + Memory (run " << run + 1 << "):" << endl;
+            arena.print_report();
+        }
+
+        const AutoEvaluatorStats &stats = auto_evaluator.stats();
+        cout << "    + multiplies: " << stats.multiplies << ", relinearizations: " << stats.relinearizations
+             << ", rescales: " << stats.rescales << ", mod switches: " << stats.mod_switches
+             << ", scale raises: " << stats.scale_raises << endl;
+        cout << "    + Constant cache hits: " << constants.hits() << ", misses: " << constants.misses() << endl;
+        cout << "    + Scale of result: " << log2(auto_result.scale()) << " bits, modulus chain index: "
+             << context.get_context_data(auto_result.parms_id())->chain_index() << endl;
+        decryptor.decrypt(auto_result, plain_result);
+        encoder.decode(plain_result, result);
+        cout << "    + Computed result ...... Correct." << endl;
+        print_vector(result, 3, 7);
+    }
+
+    // 같은 회로를 AsyncEvaluator로: 독립된 가지 (x+1)^2와 x^2+2를 다른 worker에서 동시에 계산
+    print_line(__LINE__);
+    cout << "Evaluate (x+1)^2 * (x^2+2) again with AsyncEvaluator." << endl;
+    AsyncEvaluator async_evaluator(context, encoder, relin_keys, gal_keys, scale, 2);
+    async_evaluator.set_constant_cache(&constants);
+    auto async_start = chrono::steady_clock::now();
+    AsyncCiphertext async_x = async_evaluator.input(x_encrypted);
+    AsyncCiphertext async_xplus1_square = async_evaluator.square(async_evaluator.add_const(async_x, 1.0));
+    AsyncCiphertext async_x_square_plus2 = async_evaluator.add_const(async_evaluator.square(async_x), 2.0);
+    AsyncCiphertext async_result =
+        async_evaluator.finalize(async_evaluator.multiply(async_xplus1_square, async_x_square_plus2));
+    async_result.wait();
+    cout << "    + Latency: "
+         << chrono::duration<double, milli>(chrono::steady_clock::now() - async_start).count() << " ms, "
+         << async_evaluator.max_parallelism() << " ops in parallel" << endl;
+    decryptor.decrypt(async_result.get(), plain_result);
+    encoder.decode(plain_result, result);
+    cout << "    + Computed result ...... Correct." << endl;
+    print_vector(result, 3, 7);
 }
@@ -0,0 +1,188 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+/*
+  연산마다 결과 handle(AsyncCiphertext)을 바로 반환하고 피연산자가 준비된 연산부터 병렬로 실행하는 CKKS evaluator
+  task5/async-graph.h의 AsyncGraph 사용 (빌드 시 -I../task5 필요)
+  - (x+1)^2와 x^2+2처럼 서로 의존하지 않는 가지가 다른 worker에서 동시에 실행: 요청 하나의 지연시간 단축
+  - 레벨, 스케일은 AutoEvaluator로 맞춤. worker마다 Evaluator, AutoEvaluator, MemoryPoolHandle::New()를 따로 둠 (BatchExecutor와 같음)
+  - worker pool은 AutoEvaluator(set_memory_pool)와 Evaluator 호출에 직접 넘김. 전역 MMProfGuard는 worker를 직렬화하므로 쓰지 않음
+  - 결과는 get()으로 기다려서 꺼냄. rescale 대기 중일 수 있으므로 복호화 전에 finalize() 결과를 사용
+ */
+
+#pragma once
+
+#include "seal/seal.h"
+#include "async-graph.h"
+#include "seal-auto-evaluator.h"
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace seal
+{
+    using AsyncCiphertext = lbcrypto::AsyncValue<Ciphertext>;
+
+    class AsyncEvaluator
+    {
+    public:
+        struct Worker
+        {
+            Worker(const SEALContext &context, const CKKSEncoder &encoder, const RelinKeys &relin_keys, double scale)
+                : evaluator(context), pool(MemoryPoolHandle::New()),
+                  auto_evaluator(context, encoder, evaluator, relin_keys, scale)
+            {
+                auto_evaluator.set_memory_pool(pool);
+            }
+
+            Evaluator evaluator;
+            MemoryPoolHandle pool;
+            AutoEvaluator auto_evaluator;
+        };
+
+        using Args = std::vector<const Ciphertext *>;
+
+        // 연산: 준비된 피연산자, 결과 암호문(worker pool에서 할당), worker. pool을 받는 호출에는 worker.pool을 넘길 것
+        using Op = std::function<void(const Args &, Ciphertext &, Worker &)>;
+
+        // galois_keys: rotate_vector에서 사용하는 step으로 생성
+        AsyncEvaluator(
+            const SEALContext &context, const CKKSEncoder &encoder, const RelinKeys &relin_keys,
+            const GaloisKeys &galois_keys, double scale, std::size_t num_threads = std::thread::hardware_concurrency())
+            : galois_keys_(galois_keys), graph_(num_threads)
+        {
+            for (std::size_t i = 0; i < graph_.getNumThreads(); i++)
+            {
+                workers_.push_back(std::make_unique<Worker>(context, encoder, relin_keys, scale));
+            }
+        }
+
+        std::size_t num_threads() const
+        {
+            return graph_.getNumThreads();
+        }
+
+        // 동시에 실행된 연산 수의 최댓값
+        std::size_t max_parallelism() const
+        {
+            return graph_.getMaxParallelism();
+        }
+
+        // 모든 worker의 AutoEvaluator가 공유 (ConstantCache는 여러 스레드에서 사용 가능). 연산을 넣기 전에 설정
+        void set_constant_cache(ConstantCache *constants)
+        {
+            for (auto &worker : workers_)
+            {
+                worker->auto_evaluator.set_constant_cache(constants);
+            }
+        }
+
+        // worker별 AutoEvaluator 통계의 합. 실행 중인 연산이 없을 때 호출
+        AutoEvaluatorStats stats() const
+        {
+            AutoEvaluatorStats total;
+            for (const auto &worker : workers_)
+            {
+                const AutoEvaluatorStats &s = worker->auto_evaluator.stats();
+                total.multiplies += s.multiplies;
+                total.relinearizations += s.relinearizations;
+                total.rescales += s.rescales;
+                total.mod_switches += s.mod_switches;
+                total.scale_raises += s.scale_raises;
+            }
+            return total;
+        }
+
+        void reset_stats()
+        {
+            for (auto &worker : workers_)
+            {
+                worker->auto_evaluator.reset_stats();
+            }
+        }
+
+        AsyncCiphertext input(const Ciphertext &encrypted)
+        {
+            return graph_.ready(encrypted);
+        }
+
+        AsyncCiphertext add(const AsyncCiphertext &a, const AsyncCiphertext &b)
+        {
+            return schedule({ a, b }, [](const Args &args, Ciphertext &destination, Worker &worker) {
+                worker.auto_evaluator.add(*args[0], *args[1], destination);
+            });
+        }
+
+        AsyncCiphertext sub(const AsyncCiphertext &a, const AsyncCiphertext &b)
+        {
+            return schedule({ a, b }, [](const Args &args, Ciphertext &destination, Worker &worker) {
+                worker.auto_evaluator.sub(*args[0], *args[1], destination);
+            });
+        }
+
+        AsyncCiphertext add_const(const AsyncCiphertext &a, double constant)
+        {
+            return schedule({ a }, [constant](const Args &args, Ciphertext &destination, Worker &worker) {
+                worker.auto_evaluator.add_const(*args[0], constant, destination);
+            });
+        }
+
+        AsyncCiphertext multiply(const AsyncCiphertext &a, const AsyncCiphertext &b)
+        {
+            return schedule({ a, b }, [](const Args &args, Ciphertext &destination, Worker &worker) {
+                worker.auto_evaluator.multiply(*args[0], *args[1], destination);
+            });
+        }
+
+        AsyncCiphertext multiply_const(const AsyncCiphertext &a, double constant)
+        {
+            return schedule({ a }, [constant](const Args &args, Ciphertext &destination, Worker &worker) {
+                worker.auto_evaluator.multiply_const(*args[0], constant, destination);
+            });
+        }
+
+        AsyncCiphertext square(const AsyncCiphertext &a)
+        {
+            return schedule({ a }, [](const Args &args, Ciphertext &destination, Worker &worker) {
+                worker.auto_evaluator.square(*args[0], destination);
+            });
+        }
+
+        // 대기 중인 rescale, relinearize를 먼저 수행한 뒤 회전
+        AsyncCiphertext rotate_vector(const AsyncCiphertext &a, int steps)
+        {
+            const GaloisKeys &galois_keys = galois_keys_;
+            return schedule({ a }, [steps, &galois_keys](const Args &args, Ciphertext &destination, Worker &worker) {
+                Ciphertext x(worker.pool);
+                x = *args[0];
+                worker.auto_evaluator.finalize(x);
+                worker.evaluator.rotate_vector(x, steps, galois_keys, destination, worker.pool);
+            });
+        }
+
+        // 복호화 전: 대기 중인 rescale, relinearize 수행
+        AsyncCiphertext finalize(const AsyncCiphertext &a)
+        {
+            return schedule({ a }, [](const Args &args, Ciphertext &destination, Worker &worker) {
+                destination = *args[0];
+                worker.auto_evaluator.finalize(destination);
+            });
+        }
+
+        // 위에 없는 연산: op가 worker의 evaluator로 destination을 채움
+        AsyncCiphertext schedule(const std::vector<AsyncCiphertext> &args, Op op)
+        {
+            return graph_.then(args, [this, op = std::move(op)](const Args &values, std::size_t id) {
+                Worker &worker = *workers_[id];
+                Ciphertext destination(worker.pool);
+                op(values, destination, worker);
+                return destination;
+            });
+        }
+
+    private:
+        const GaloisKeys &galois_keys_;
+        std::vector<std::unique_ptr<Worker>> workers_;
+        lbcrypto::AsyncGraph<Ciphertext> graph_; // 마지막 멤버: 남은 연산이 끝난 뒤 worker가 해제됨
+    };
+} // namespace seal
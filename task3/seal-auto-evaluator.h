@@ -0,0 +1,322 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+/*
+  SEAL CKKS evaluator wrapper: scale, level 자동 정렬
+  - 곱셈 결과는 바로 rescale하지 않고(pending), 다음 곱셈이나 덧셈에서 필요할 때만 rescale
+  - lazy relinearization: 곱셈 결과를 크기 3 그대로 두고 더한 뒤, 다음 곱셈이나 finalize()에서 한 번만 relinearize
+  - 레벨이 다르면 mod switch(NTT 없음)로 맞춤
+  - 스케일이 다르면 scale() 값을 덮어쓰지 않고, 상수 1을 비율만큼의 스케일로 인코딩해 곱해서(multiply_plain) 정확히 맞춤
+  - 임시 암호문과 Evaluator 내부 할당은 set_memory_pool()로 정한 pool 사용 (기본: 호출 시점의 기본 pool)
+ */
+
+#pragma once
+
+#include "seal/seal.h"
+#include "seal-constant-cache.h"
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+namespace seal
+{
+    struct AutoEvaluatorStats
+    {
+        std::size_t multiplies = 0;
+        std::size_t relinearizations = 0;
+        std::size_t rescales = 0;
+        std::size_t mod_switches = 0;
+        std::size_t scale_raises = 0; // 스케일 보정용 multiply_plain
+    };
+
+    class AutoEvaluator
+    {
+    public:
+        // scale: 입력 암호문의 스케일(Δ). rescale 대기 여부 판단에 사용
+        AutoEvaluator(
+            const SEALContext &context, const CKKSEncoder &encoder, const Evaluator &evaluator,
+            const RelinKeys &relin_keys, double scale)
+            : context_(context), encoder_(encoder), evaluator_(evaluator), relin_keys_(relin_keys),
+              pending_log2_scale_(1.5 * std::log2(scale)), min_raise_ratio_(std::sqrt(scale))
+        {}
+
+        // true면 곱셈 직후 relinearize하지 않음. a*b + c*d + ... 에서 항마다 key switching 1번씩 절약
+        void set_lazy_relinearization(bool lazy)
+        {
+            lazy_relin_ = lazy;
+        }
+
+        bool lazy_relinearization() const
+        {
+            return lazy_relin_;
+        }
+
+        // 상수 인코딩 결과를 재사용 (nullptr: 매번 인코딩)
+        void set_constant_cache(ConstantCache *constants)
+        {
+            constants_ = constants;
+        }
+
+        // 모든 Evaluator 호출과 임시 암호문에 넘길 pool. 여러 스레드에서 쓸 때 worker마다 따로 지정
+        void set_memory_pool(MemoryPoolHandle pool)
+        {
+            pool_ = std::move(pool);
+        }
+
+        // 지정하지 않았으면 호출 시점의 기본 pool (MemoryScope 안에서는 그 arena)
+        MemoryPoolHandle memory_pool() const
+        {
+            return pool_ ? pool_ : MemoryManager::GetPool();
+        }
+
+        void multiply(const Ciphertext &a, const Ciphertext &b, Ciphertext &destination)
+        {
+            Ciphertext x = copy(a), y = copy(b);
+            prepare_operand(x);
+            prepare_operand(y);
+            align_levels(x, y);
+            evaluator_.multiply(x, y, destination, memory_pool());
+            stats_.multiplies++;
+            if (!lazy_relin_)
+            {
+                relinearize(destination);
+            }
+        }
+
+        void multiply_inplace(Ciphertext &a, const Ciphertext &b)
+        {
+            Ciphertext result(memory_pool());
+            multiply(a, b, result);
+            a = std::move(result);
+        }
+
+        void square(const Ciphertext &a, Ciphertext &destination)
+        {
+            Ciphertext x = copy(a);
+            prepare_operand(x);
+            evaluator_.square(x, destination, memory_pool());
+            stats_.multiplies++;
+            if (!lazy_relin_)
+            {
+                relinearize(destination);
+            }
+        }
+
+        // 상수를 현재 레벨의 마지막 소수 q로 인코딩: 나중에 rescale하면 스케일이 정확히 원래 값으로 돌아옴
+        void multiply_const(const Ciphertext &a, double constant, Ciphertext &destination)
+        {
+            Ciphertext x = copy(a);
+            rescale_if_pending(x);
+            double q = last_prime(x);
+            require_fits(x.scale() * q, x.parms_id());
+            Plaintext scratch(memory_pool());
+            evaluator_.multiply_plain(x, encode(constant, x.parms_id(), q, scratch), destination, memory_pool());
+        }
+
+        void add(const Ciphertext &a, const Ciphertext &b, Ciphertext &destination)
+        {
+            Ciphertext x = copy(a), y = copy(b);
+            align_levels(x, y);
+            match_scales(x, y);
+            evaluator_.add(x, y, destination);
+        }
+
+        void add_inplace(Ciphertext &a, const Ciphertext &b)
+        {
+            Ciphertext result(memory_pool());
+            add(a, b, result);
+            a = std::move(result);
+        }
+
+        void sub(const Ciphertext &a, const Ciphertext &b, Ciphertext &destination)
+        {
+            Ciphertext negated(memory_pool());
+            evaluator_.negate(b, negated);
+            add(a, negated, destination);
+        }
+
+        void add_const(const Ciphertext &a, double constant, Ciphertext &destination)
+        {
+            Plaintext scratch(memory_pool());
+            evaluator_.add_plain(a, encode(constant, a.parms_id(), a.scale(), scratch), destination, memory_pool());
+        }
+
+        void negate(const Ciphertext &a, Ciphertext &destination)
+        {
+            evaluator_.negate(a, destination);
+        }
+
+        void rescale_if_pending(Ciphertext &ct)
+        {
+            if (is_pending(ct))
+            {
+                rescale(ct);
+            }
+        }
+
+        // 결과를 내보내기 전(복호화, rotation 등) 대기 중인 rescale, relinearize 수행
+        void finalize(Ciphertext &ct)
+        {
+            prepare_operand(ct);
+        }
+
+        bool is_pending(const Ciphertext &ct) const
+        {
+            return std::log2(ct.scale()) > pending_log2_scale_;
+        }
+
+        const AutoEvaluatorStats &stats() const
+        {
+            return stats_;
+        }
+
+        void reset_stats()
+        {
+            stats_ = AutoEvaluatorStats();
+        }
+
+    private:
+        // 값의 크기를 위해 남겨 두는 비트 수
+        static constexpr int headroom_bits = 20;
+
+        std::size_t chain_index(const Ciphertext &ct) const
+        {
+            return context_.get_context_data(ct.parms_id())->chain_index();
+        }
+
+        double last_prime(const Ciphertext &ct) const
+        {
+            return static_cast<double>(
+                context_.get_context_data(ct.parms_id())->parms().coeff_modulus().back().value());
+        }
+
+        bool fits(double scale, parms_id_type parms_id) const
+        {
+            return std::log2(scale) + headroom_bits <
+                   context_.get_context_data(parms_id)->total_coeff_modulus_bit_count();
+        }
+
+        void require_fits(double scale, parms_id_type parms_id) const
+        {
+            if (!fits(scale, parms_id))
+            {
+                throw std::logic_error("AutoEvaluator: out of levels");
+            }
+        }
+
+        const Plaintext &encode(double value, parms_id_type parms_id, double scale, Plaintext &scratch) const
+        {
+            if (constants_)
+            {
+                return constants_->get(value, parms_id, scale);
+            }
+            encoder_.encode(value, parms_id, scale, scratch, memory_pool());
+            return scratch;
+        }
+
+        // memory_pool()에 할당한 사본
+        Ciphertext copy(const Ciphertext &ct) const
+        {
+            Ciphertext result(memory_pool());
+            result = ct;
+            return result;
+        }
+
+        // 곱셈 피연산자: rescale 후 relinearize (limb가 하나 적은 상태에서 key switching)
+        void prepare_operand(Ciphertext &ct)
+        {
+            rescale_if_pending(ct);
+            if (ct.size() > 2)
+            {
+                relinearize(ct);
+            }
+        }
+
+        void relinearize(Ciphertext &ct)
+        {
+            evaluator_.relinearize_inplace(ct, relin_keys_, memory_pool());
+            stats_.relinearizations++;
+        }
+
+        void rescale(Ciphertext &ct)
+        {
+            if (chain_index(ct) == 0)
+            {
+                throw std::logic_error("AutoEvaluator: out of levels");
+            }
+            evaluator_.rescale_to_next_inplace(ct, memory_pool());
+            stats_.rescales++;
+        }
+
+        // 상수 1을 스케일 factor로 인코딩해서 곱함: 값은 그대로, 스케일만 factor배
+        void raise(Ciphertext &ct, double factor)
+        {
+            require_fits(ct.scale() * factor, ct.parms_id());
+            Plaintext scratch(memory_pool());
+            evaluator_.multiply_plain_inplace(ct, encode(1.0, ct.parms_id(), factor, scratch), memory_pool());
+            stats_.scale_raises++;
+        }
+
+        // 높은 레벨 쪽을 mod switch. rescale 대기 중인 암호문이 낮은 레벨에 들어가지 않으면 먼저 rescale
+        void align_levels(Ciphertext &x, Ciphertext &y)
+        {
+            while (chain_index(x) != chain_index(y))
+            {
+                Ciphertext &hi = chain_index(x) > chain_index(y) ? x : y;
+                const Ciphertext &lo = &hi == &x ? y : x;
+                if (is_pending(hi) && !fits(hi.scale(), lo.parms_id()))
+                {
+                    rescale(hi);
+                    continue;
+                }
+                stats_.mod_switches += chain_index(hi) - chain_index(lo);
+                evaluator_.mod_switch_to_inplace(hi, lo.parms_id(), memory_pool());
+            }
+        }
+
+        // 같은 레벨의 두 암호문 스케일을 정확히 일치시킴
+        //  - 비율이 크면(rescale 대기 중 vs 아님): 작은 쪽을 비율만큼 raise
+        //  - 비율이 1에 가까우면(소수가 달라 생긴 drift): 대기 중이면 rescale 후 다시 비교,
+        //    아니면 양쪽을 raise해서 s_hi * q로 맞춤 (다음 rescale에서 s_hi로 돌아옴)
+        void match_scales(Ciphertext &x, Ciphertext &y)
+        {
+            if (x.scale() == y.scale())
+            {
+                return;
+            }
+            Ciphertext &hi = x.scale() > y.scale() ? x : y;
+            Ciphertext &lo = &hi == &x ? y : x;
+            double ratio = hi.scale() / lo.scale();
+            if (ratio >= min_raise_ratio_ && fits(hi.scale(), lo.parms_id()))
+            {
+                raise(lo, ratio);
+            }
+            else if (is_pending(hi))
+            {
+                rescale(hi);
+                align_levels(x, y);
+                match_scales(x, y);
+                return;
+            }
+            else
+            {
+                double q = last_prime(hi);
+                raise(lo, ratio * q);
+                raise(hi, q);
+            }
+            // 두 스케일은 이제 정확히 같은 값의 곱이고, 남은 차이는 double 반올림뿐
+            lo.scale() = hi.scale();
+        }
+
+        const SEALContext &context_;
+        const CKKSEncoder &encoder_;
+        const Evaluator &evaluator_;
+        const RelinKeys &relin_keys_;
+        double pending_log2_scale_;
+        double min_raise_ratio_;
+        bool lazy_relin_ = false;
+        ConstantCache *constants_ = nullptr;
+        MemoryPoolHandle pool_;
+        AutoEvaluatorStats stats_;
+    };
+} // namespace seal
@@ -0,0 +1,81 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+/*
+  같은 회로를 여러 암호문에 병렬로 적용하는 batch executor
+  task5/work-stealing-pool.h의 WorkStealingPool 사용 (빌드 시 -I../task5 필요)
+  - worker마다 Evaluator와 MemoryPoolHandle::New()를 따로 둠: 전역 memory pool의 lock 경합 제거
+  - 회로는 worker.pool을 Evaluator 호출과 임시 Ciphertext에 직접 넘김. MMProfGuard는 프로세스 전역이고 전역 mutex를 잡아
+    worker들을 직렬화하므로 쓰지 않음
+ */
+
+#pragma once
+
+#include "seal/seal.h"
+#include "work-stealing-pool.h"
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace seal
+{
+    class BatchExecutor
+    {
+    public:
+        struct Worker
+        {
+            Worker(const SEALContext &context) : evaluator(context), pool(MemoryPoolHandle::New())
+            {}
+
+            Evaluator evaluator;
+            MemoryPoolHandle pool;
+        };
+
+        // 회로: 입력 암호문 하나, 출력 암호문 하나. worker의 evaluator를 쓰고, pool을 받는 호출에는 모두 worker.pool을 넘길 것
+        using Circuit = std::function<void(const Ciphertext &, Ciphertext &, Worker &)>;
+
+        BatchExecutor(const SEALContext &context, std::size_t num_threads = std::thread::hardware_concurrency())
+            : pool_(num_threads)
+        {
+            for (std::size_t i = 0; i < pool_.size(); i++)
+            {
+                workers_.push_back(std::make_unique<Worker>(context));
+            }
+        }
+
+        std::size_t num_threads() const
+        {
+            return pool_.size();
+        }
+
+        std::size_t steal_count() const
+        {
+            return pool_.getStealCount();
+        }
+
+        // grain: 한 번에 가져가는 암호문 수. 0이면 worker당 chunk 4개 정도가 되도록 정함
+        void run(
+            const std::vector<Ciphertext> &inputs, std::vector<Ciphertext> &outputs, const Circuit &circuit,
+            std::size_t grain = 0)
+        {
+            outputs.resize(inputs.size());
+            if (grain == 0)
+            {
+                grain = std::max<std::size_t>(1, inputs.size() / (4 * pool_.size()));
+            }
+            pool_.parallelFor(inputs.size(), grain, [&](std::size_t begin, std::size_t end, std::size_t id) {
+                Worker &worker = *workers_[id];
+                for (std::size_t i = begin; i < end; i++)
+                {
+                    Ciphertext result(worker.pool);
+                    circuit(inputs[i], result, worker);
+                    outputs[i] = std::move(result);
+                }
+            });
+        }
+
+    private:
+        lbcrypto::WorkStealingPool pool_;
+        std::vector<std::unique_ptr<Worker>> workers_;
+    };
+} // namespace seal
@@ -0,0 +1,37 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+/*
+  task5/budget-analyzer.h의 정적 분석을 SEAL 파라미터로 (빌드 시 -I../task5 필요)
+  SEALContext만 있으면 되므로 KeyGenerator 전에 회로의 레벨, 스케일 문제를 확인할 수 있음
+  - modulus chain은 first_context_data()의 소수 (special prime 제외), 입력 스케일은 encode에 쓰는 Δ
+  - Evaluator를 직접 쓰는 코드는 RescaleMode::MANUAL, AutoEvaluator나 SEALTraceBackend는 RescaleMode::AUTO
+ */
+
+#pragma once
+
+#include "seal/seal.h"
+#include "budget-analyzer.h"
+#include <cstdint>
+#include <vector>
+
+namespace seal
+{
+    inline lbcrypto::ModulusChain budget_modulus_chain(const SEALContext &context, double scale)
+    {
+        auto context_data = context.first_context_data();
+        std::vector<std::uint64_t> primes;
+        for (const auto &q : context_data->parms().coeff_modulus())
+        {
+            primes.push_back(q.value());
+        }
+        return lbcrypto::ModulusChain::fromPrimes(
+            static_cast<std::uint32_t>(context_data->parms().poly_modulus_degree()), primes, scale);
+    }
+
+    inline lbcrypto::BudgetAnalyzer budget_analyzer(
+        const SEALContext &context, double scale, lbcrypto::RescaleMode mode = lbcrypto::RescaleMode::MANUAL)
+    {
+        return lbcrypto::BudgetAnalyzer(budget_modulus_chain(context, scale), mode);
+    }
+} // namespace seal
@@ -0,0 +1,81 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+/*
+  인코딩된 상수 plaintext 캐시: (value, scale, parms_id)마다 한 번만 인코딩
+  - 필요한 레벨(parms_id)로 바로 인코딩하므로 mod_switch_to_inplace(plain, ...) 불필요
+  - 여러 스레드에서 공유 가능 (조회는 shared lock). 반환된 참조는 clear() 전까지 유효
+ */
+
+#pragma once
+
+#include "seal/seal.h"
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include <tuple>
+
+namespace seal
+{
+    class ConstantCache
+    {
+    public:
+        explicit ConstantCache(const CKKSEncoder &encoder) : encoder_(encoder)
+        {}
+
+        const Plaintext &get(double value, parms_id_type parms_id, double scale)
+        {
+            Key key{ parms_id, scale, value };
+            {
+                std::shared_lock<std::shared_mutex> lock(mutex_);
+                auto it = plains_.find(key);
+                if (it != plains_.end())
+                {
+                    hits_++;
+                    return it->second;
+                }
+            }
+            // 인코딩은 lock 밖에서. 다른 스레드가 먼저 넣었으면 그 결과를 사용
+            Plaintext plain;
+            encoder_.encode(value, parms_id, scale, plain);
+            misses_++;
+            std::unique_lock<std::shared_mutex> lock(mutex_);
+            return plains_.emplace(key, std::move(plain)).first->second;
+        }
+
+        std::size_t hits() const
+        {
+            return hits_;
+        }
+
+        std::size_t misses() const
+        {
+            return misses_;
+        }
+
+        std::size_t size() const
+        {
+            std::shared_lock<std::shared_mutex> lock(mutex_);
+            return plains_.size();
+        }
+
+        // 다른 스레드가 get()을 호출하고 있지 않을 때만 사용
+        void clear()
+        {
+            std::unique_lock<std::shared_mutex> lock(mutex_);
+            plains_.clear();
+            hits_ = 0;
+            misses_ = 0;
+        }
+
+    private:
+        using Key = std::tuple<parms_id_type, double, double>;
+
+        const CKKSEncoder &encoder_;
+        mutable std::shared_mutex mutex_;
+        std::map<Key, Plaintext> plains_;
+        std::atomic<std::size_t> hits_{ 0 };
+        std::atomic<std::size_t> misses_{ 0 };
+    };
+} // namespace seal
@@ -0,0 +1,55 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+/*
+  SEAL Ciphertext <-> CiphertextContainer (task5/ciphertext-container.h, 빌드 시 -I../task5 필요)
+  - encrypt_symmetric()이 반환하는 Serializable<Ciphertext>를 저장하면 c1 대신 seed만 저장 → fresh 암호문 크기가 약 절반
+  - SEAL 자체 압축은 끄고(compr_mode_type::none) 컨테이너의 zstd 옵션을 사용
+  - 읽을 때는 mmap된 영역에서 바로 load (압축하지 않은 컨테이너는 중간 복사 없음)
+ */
+
+#pragma once
+
+#include "seal/seal.h"
+#include "ciphertext-container.h"
+#include <vector>
+
+namespace seal
+{
+    template <typename T>
+    void append_to_container(
+        lbcrypto::ContainerWriter &writer, const T &object, const std::vector<std::complex<double>> &shadow = {})
+    {
+        std::vector<seal_byte> buffer(static_cast<std::size_t>(object.save_size(compr_mode_type::none)));
+        auto size = object.save(buffer.data(), buffer.size(), compr_mode_type::none);
+        writer.append(reinterpret_cast<const char *>(buffer.data()), static_cast<std::size_t>(size), shadow);
+    }
+
+    // 전체 크기 암호문 (연산 결과 등)
+    inline void append_ciphertext(
+        lbcrypto::ContainerWriter &writer, const Ciphertext &encrypted,
+        const std::vector<std::complex<double>> &shadow = {})
+    {
+        append_to_container(writer, encrypted, shadow);
+    }
+
+    // seed로 압축된 fresh 암호문 (Encryptor::encrypt_symmetric의 반환값)
+    inline void append_ciphertext(
+        lbcrypto::ContainerWriter &writer, const Serializable<Ciphertext> &encrypted,
+        const std::vector<std::complex<double>> &shadow = {})
+    {
+        append_to_container(writer, encrypted, shadow);
+    }
+
+    inline void load_ciphertext(
+        const lbcrypto::ContainerReader &reader, std::size_t i, const SEALContext &context, Ciphertext &destination,
+        std::vector<char> &scratch)
+    {
+        if (reader.backend() != lbcrypto::CONTAINER_SEAL)
+        {
+            throw std::runtime_error("load_ciphertext: not a SEAL container");
+        }
+        auto data = reader.payload(i, scratch);
+        destination.load(context, reinterpret_cast<const seal_byte *>(data.first), data.second);
+    }
+} // namespace seal
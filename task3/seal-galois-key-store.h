@@ -0,0 +1,129 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+/*
+  Galois key store: step마다 GaloisKeys를 파일 하나로 저장해 두고 rotate_vector에 필요한 step만 불러옴
+  task5/lru-key-cache.h, mapped-file.h 사용 (빌드 시 -I../task5 필요)
+  - 메모리 상한(압축하지 않은 직렬화 크기 기준)을 넘으면 가장 오래 안 쓴 step부터 내보냄
+  - 사용 중인 키는 shared_ptr로 잡혀 있어 여러 스레드에서 rotate_vector 가능
+  - 불러오는 step의 키만 있으므로 2의 거듭제곱 분해 없이 key switching 1번으로 회전
+ */
+
+#pragma once
+
+#include "seal/seal.h"
+#include "lru-key-cache.h"
+#include "mapped-file.h"
+#include <fstream>
+#include <string>
+#include <sys/stat.h>
+#include <vector>
+
+namespace seal
+{
+    class GaloisKeyStore
+    {
+    public:
+        // capacity_bytes: 메모리에 둘 Galois key 크기 상한
+        GaloisKeyStore(const SEALContext &context, std::string dir, std::size_t capacity_bytes)
+            : context_(context), dir_(std::move(dir)),
+              cache_(capacity_bytes, [this](const int &step, std::size_t &bytes) { return load(step, bytes); })
+        {}
+
+        GaloisKeyStore(const GaloisKeyStore &) = delete;
+        GaloisKeyStore &operator=(const GaloisKeyStore &) = delete;
+
+        // step마다 생성 → 파일로 저장 → 해제. 전체 key 집합이 메모리에 동시에 올라오지 않음
+        static void generate(KeyGenerator &keygen, const std::vector<int> &steps, const std::string &dir)
+        {
+            ::mkdir(dir.c_str(), 0755);
+            for (int step : steps)
+            {
+                GaloisKeys keys;
+                keygen.create_galois_keys(std::vector<int>{ step }, keys);
+                std::ofstream out(file(dir, step), std::ios::binary);
+                if (!out)
+                {
+                    throw std::runtime_error("GaloisKeyStore: cannot write " + file(dir, step));
+                }
+                keys.save(out, compr_mode_type::none);
+            }
+        }
+
+        bool has(int step) const
+        {
+            std::ifstream in(file(dir_, step));
+            return static_cast<bool>(in);
+        }
+
+        // 곧 사용할 step의 키를 미리 불러옴
+        void prefetch(const std::vector<int> &steps)
+        {
+            for (int step : steps)
+            {
+                cache_.get(step);
+            }
+        }
+
+        std::shared_ptr<GaloisKeys> keys(int step)
+        {
+            return cache_.get(step);
+        }
+
+        void rotate_vector(const Evaluator &evaluator, const Ciphertext &encrypted, int step, Ciphertext &destination)
+        {
+            std::shared_ptr<GaloisKeys> galois_keys = cache_.get(step);
+            evaluator.rotate_vector(encrypted, step, *galois_keys, destination);
+        }
+
+        void rotate_vector_inplace(const Evaluator &evaluator, Ciphertext &encrypted, int step)
+        {
+            std::shared_ptr<GaloisKeys> galois_keys = cache_.get(step);
+            evaluator.rotate_vector_inplace(encrypted, step, *galois_keys);
+        }
+
+        const std::string &dir() const
+        {
+            return dir_;
+        }
+
+        std::size_t resident_count() const
+        {
+            return cache_.size();
+        }
+
+        void set_capacity(std::size_t capacity_bytes)
+        {
+            cache_.setCapacity(capacity_bytes);
+        }
+
+        lbcrypto::KeyCacheStats stats() const
+        {
+            return cache_.getStats();
+        }
+
+        void reset_stats()
+        {
+            cache_.resetStats();
+        }
+
+    private:
+        static std::string file(const std::string &dir, int step)
+        {
+            return dir + "/galois-" + std::to_string(step) + ".bin";
+        }
+
+        std::shared_ptr<GaloisKeys> load(int step, std::size_t &bytes) const
+        {
+            lbcrypto::MappedFile mapped(file(dir_, step));
+            auto keys = std::make_shared<GaloisKeys>();
+            keys->load(context_, reinterpret_cast<const seal_byte *>(mapped.data()), mapped.size());
+            bytes = mapped.size();
+            return keys;
+        }
+
+        const SEALContext &context_;
+        std::string dir_;
+        lbcrypto::LruKeyCache<int, GaloisKeys> cache_;
+    };
+} // namespace seal
@@ -0,0 +1,172 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+/*
+  SEAL 키 스냅샷: 처음 실행할 때 암호화 파라미터와 secret/public/relin/galois key를 저장하고
+  다음 실행부터는 KeyGenerator 대신 불러옴 (task5/mapped-file.h 사용, 빌드 시 -I../task5 필요)
+  - 키는 mmap한 파일에서 바로 load
+  - 저장된 파라미터나 tag(galois step 등)가 현재와 다르면 불러오지 않음
+ */
+
+#pragma once
+
+#include "seal/seal.h"
+#include "mapped-file.h"
+#include <cerrno>
+#include <cstdio>
+#include <fcntl.h>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace seal
+{
+    class KeySnapshot
+    {
+    public:
+        // tag: 파라미터 외에 키 구성을 구분하는 문자열. 예) "galois 2"
+        KeySnapshot(std::string dir, std::string tag) : dir_(std::move(dir)), tag_(std::move(tag))
+        {}
+
+        const std::string &dir() const
+        {
+            return dir_;
+        }
+
+        bool exists(const SEALContext &context) const
+        {
+            std::ifstream in(file("manifest.txt"));
+            std::string saved;
+            if (!in || !std::getline(in, saved) || saved != tag_)
+            {
+                return false;
+            }
+            std::ifstream parms_in(file("parms.bin"), std::ios::binary);
+            std::string saved_parms((std::istreambuf_iterator<char>(parms_in)), std::istreambuf_iterator<char>());
+            return saved_parms == serialized_parms(context);
+        }
+
+        void save(
+            const SEALContext &context, const SecretKey &secret_key, const PublicKey &public_key,
+            const RelinKeys &relin_keys, const GaloisKeys &galois_keys) const
+        {
+            if (::mkdir(dir_.c_str(), 0700) != 0 && errno != EEXIST)
+            {
+                throw std::runtime_error("KeySnapshot: cannot create " + dir_);
+            }
+            if (::chmod(dir_.c_str(), 0700) != 0)
+            {
+                throw std::runtime_error("KeySnapshot: cannot chmod " + dir_);
+            }
+            // manifest를 먼저 지움: 키를 쓰는 도중에 실패하면 다음 실행에서 exists()가 false
+            if (std::remove(file("manifest.txt").c_str()) != 0 && errno != ENOENT)
+            {
+                throw std::runtime_error("KeySnapshot: cannot remove " + file("manifest.txt"));
+            }
+            {
+                std::ofstream out = open_private("parms.bin");
+                out << serialized_parms(context);
+                finish(out, "parms.bin");
+            }
+            save_object("secret-key.bin", secret_key);
+            save_object("public-key.bin", public_key);
+            save_object("relin-keys.bin", relin_keys);
+            save_object("galois-keys.bin", galois_keys);
+            // manifest는 모든 키를 쓴 뒤 마지막에
+            std::ofstream manifest = open_private("manifest.txt");
+            manifest << tag_ << "\n";
+            finish(manifest, "manifest.txt");
+        }
+
+        // 스냅샷이 없거나 파라미터/tag가 다르거나 역직렬화에 실패하면(손상된 파일 등) false. 호출한 쪽은 키를 새로 생성
+        bool load(
+            const SEALContext &context, SecretKey &secret_key, PublicKey &public_key, RelinKeys &relin_keys,
+            GaloisKeys &galois_keys) const
+        {
+            if (!exists(context))
+            {
+                return false;
+            }
+            try
+            {
+                load_object(context, "secret-key.bin", secret_key);
+                load_object(context, "public-key.bin", public_key);
+                load_object(context, "relin-keys.bin", relin_keys);
+                load_object(context, "galois-keys.bin", galois_keys);
+            }
+            catch (const std::exception &e)
+            {
+                std::cerr << "KeySnapshot: cannot load " << dir_ << " (" << e.what() << "), regenerating keys" << std::endl;
+                return false;
+            }
+            return true;
+        }
+
+    private:
+        std::string file(const std::string &name) const
+        {
+            return dir_ + "/" + name;
+        }
+
+        static std::string serialized_parms(const SEALContext &context)
+        {
+            std::ostringstream os;
+            context.key_context_data()->parms().save(os, compr_mode_type::none);
+            return os.str();
+        }
+
+        // secret key가 들어 있으므로 소유자만 읽을 수 있게 0600으로 만든 뒤 연다 (이미 있던 파일도 0600으로)
+        std::ofstream open_private(const std::string &name) const
+        {
+            const std::string path = file(name);
+            int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+            if (fd < 0 || ::fchmod(fd, 0600) != 0)
+            {
+                if (fd >= 0)
+                {
+                    ::close(fd);
+                }
+                throw std::runtime_error("KeySnapshot: cannot write " + path);
+            }
+            ::close(fd);
+            std::ofstream out(path, std::ios::binary | std::ios::trunc);
+            if (!out)
+            {
+                throw std::runtime_error("KeySnapshot: cannot write " + path);
+            }
+            return out;
+        }
+
+        void finish(std::ofstream &out, const std::string &name) const
+        {
+            out.close();
+            if (!out)
+            {
+                throw std::runtime_error("KeySnapshot: write failed " + file(name));
+            }
+        }
+
+        template <typename T>
+        void save_object(const std::string &name, const T &object) const
+        {
+            std::ofstream out = open_private(name);
+            object.save(out, compr_mode_type::none);
+            finish(out, name);
+        }
+
+        template <typename T>
+        void load_object(const SEALContext &context, const std::string &name, T &object) const
+        {
+            lbcrypto::MappedFile mapped(file(name));
+            object.load(context, reinterpret_cast<const seal_byte *>(mapped.data()), mapped.size());
+        }
+
+        std::string dir_;
+        std::string tag_;
+    };
+} // namespace seal
@@ -0,0 +1,164 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+/*
+  평가 구간 전용 memory arena와 연산별 메모리 집계
+  - 프로세스 전체의 기본 memory profile을 전용 MemoryPoolHandle로 바꿈 (MMProfGuard). 범위를 벗어나면 원래 profile로 복원
+    → 회로 안의 임시 암호문, Evaluator 내부 할당이 모두 이 arena에서 이루어지고, 해제된 버퍼는 arena 안에서 재사용
+  - MMProfGuard는 스레드별이 아니라 전역: 살아 있는 동안 pool을 지정하지 않은 모든 스레드의 할당이 이 arena로 가고,
+    SEAL의 전역 profile mutex를 잡고 있으므로 다른 스레드의 MMProfGuard는 이 범위가 끝날 때까지 막힘
+    → 단일 스레드 구간 전용. 여러 스레드에서 쓸 때는 pool을 Evaluator/Ciphertext 호출에 직접 넘길 것 (seal-batch-executor.h)
+  - acquire()/release(): 결과 암호문 객체를 재사용 (이미 확보한 버퍼 크기 그대로 다음 연산에 사용)
+  - track(op, fn): 연산마다 arena가 늘어난 크기, 늘어난 횟수, 연산 후 arena 크기(최대 상주 크기) 기록
+  SEAL pool은 메모리를 반환하지 않으므로 arena 크기 = 지금까지의 최대 사용량. 같은 회로를 두 번째 실행할 때 증가량이 0이면
+  필요한 메모리를 모두 재사용하고 있다는 뜻이고, 이때의 arena 크기로 worker 메모리를 정하면 됨
+ */
+
+#pragma once
+
+#include "seal/seal.h"
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace seal
+{
+    struct OpMemoryStats
+    {
+        std::size_t calls = 0;
+        std::size_t growth_bytes = 0; // 연산 중 arena가 늘어난 크기 합계
+        std::size_t growths = 0;      // arena가 늘어난 호출 수 (나머지 호출은 재사용된 버퍼만 사용)
+        std::size_t peak_bytes = 0;   // 연산 직후 arena 크기의 최대값
+    };
+
+    class MemoryScope
+    {
+    public:
+        // 프로세스 전역. 한 번에 하나만 (겹치게 두 개를 만들면 두 번째가 전역 mutex에서 막힘), 단일 스레드 구간에서만 사용
+        explicit MemoryScope(MemoryPoolHandle pool = MemoryPoolHandle::New())
+            : pool_(std::move(pool)), guard_(std::make_unique<MMProfFixed>(pool_))
+        {}
+
+        MemoryScope(const MemoryScope &) = delete;
+        MemoryScope &operator=(const MemoryScope &) = delete;
+
+        const MemoryPoolHandle &pool() const
+        {
+            return pool_;
+        }
+
+        // 현재 arena 크기 = 이 범위의 최대 상주 크기
+        std::size_t footprint() const
+        {
+            return pool_.alloc_byte_count();
+        }
+
+        // 재사용할 암호문이 있으면 꺼내고, 없으면 arena에 새로 만듦
+        Ciphertext acquire()
+        {
+            if (free_.empty())
+            {
+                return Ciphertext(pool_);
+            }
+            Ciphertext ct = std::move(free_.back());
+            free_.pop_back();
+            return ct;
+        }
+
+        // 더 쓰지 않는 암호문을 돌려줌. 버퍼는 해제하지 않고 다음 acquire()에서 재사용
+        void release(Ciphertext &&ct)
+        {
+            free_.push_back(std::move(ct));
+        }
+
+        std::size_t free_count() const
+        {
+            return free_.size();
+        }
+
+        template <typename Fn>
+        void track(const std::string &op, Fn &&fn)
+        {
+            std::size_t before = footprint();
+            fn();
+            std::size_t after = footprint();
+            OpMemoryStats &stats = find(op);
+            stats.calls++;
+            if (after > before)
+            {
+                stats.growth_bytes += after - before;
+                stats.growths++;
+            }
+            stats.peak_bytes = std::max(stats.peak_bytes, after);
+        }
+
+        // 처음 기록된 순서대로
+        const std::vector<std::pair<std::string, OpMemoryStats>> &ops() const
+        {
+            return ops_;
+        }
+
+        // 회로 전체: 모든 연산의 합계
+        OpMemoryStats total() const
+        {
+            OpMemoryStats sum;
+            for (const auto &op : ops_)
+            {
+                sum.calls += op.second.calls;
+                sum.growth_bytes += op.second.growth_bytes;
+                sum.growths += op.second.growths;
+                sum.peak_bytes = std::max(sum.peak_bytes, op.second.peak_bytes);
+            }
+            return sum;
+        }
+
+        // 연산별 집계만 지움 (arena와 재사용 목록은 유지). 회로를 반복 실행할 때 실행마다 호출
+        void reset_stats()
+        {
+            ops_.clear();
+        }
+
+        void print_report(std::ostream &os = std::cout) const
+        {
+            std::ios::fmtflags flags = os.flags();
+            auto mb = [](std::size_t bytes) { return bytes / (1024.0 * 1024.0); };
+            os << std::fixed << std::setprecision(2);
+            os << "    " << std::left << std::setw(24) << "op" << std::right << std::setw(6) << "calls"
+               << std::setw(14) << "growth(MB)" << std::setw(9) << "growths" << std::setw(12) << "peak(MB)" << std::endl;
+            for (const auto &op : ops_)
+            {
+                os << "    " << std::left << std::setw(24) << op.first << std::right << std::setw(6) << op.second.calls
+                   << std::setw(14) << mb(op.second.growth_bytes) << std::setw(9) << op.second.growths
+                   << std::setw(12) << mb(op.second.peak_bytes) << std::endl;
+            }
+            OpMemoryStats sum = total();
+            os << "    " << std::left << std::setw(24) << "circuit" << std::right << std::setw(6) << sum.calls
+               << std::setw(14) << mb(sum.growth_bytes) << std::setw(9) << sum.growths << std::setw(12)
+               << mb(footprint()) << std::endl;
+            os.flags(flags);
+        }
+
+    private:
+        OpMemoryStats &find(const std::string &op)
+        {
+            for (auto &entry : ops_)
+            {
+                if (entry.first == op)
+                {
+                    return entry.second;
+                }
+            }
+            ops_.emplace_back(op, OpMemoryStats());
+            return ops_.back().second;
+        }
+
+        MemoryPoolHandle pool_;
+        MMProfGuard guard_;
+        std::vector<Ciphertext> free_;
+        std::vector<std::pair<std::string, OpMemoryStats>> ops_;
+    };
+} // namespace seal
@@ -0,0 +1,90 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+/*
+  SEAL CKKS backend for PolyEvaluator (task5/poly-evaluator.h)
+  연산은 모두 AutoEvaluator로: 레벨은 mod switch로, 스케일은 scale() 덮어쓰기 없이 정확히 맞춤
+  - 곱셈 결과의 rescale은 AutoEvaluator처럼 필요할 때까지 미뤄짐 → 복호화 전에 finalize()
+ */
+
+#pragma once
+
+#include "seal/seal.h"
+#include "poly-evaluator.h"
+#include "seal-auto-evaluator.h"
+#include "seal-constant-cache.h"
+
+namespace seal
+{
+    class SEALPolyBackend
+    {
+    public:
+        using Ciphertext = seal::Ciphertext;
+
+        // scale: 입력 암호문의 스케일(Δ)
+        SEALPolyBackend(
+            const SEALContext &context, const CKKSEncoder &encoder, const Evaluator &evaluator,
+            const RelinKeys &relin_keys, double scale, ConstantCache *constants = nullptr)
+            : auto_evaluator_(context, encoder, evaluator, relin_keys, scale)
+        {
+            auto_evaluator_.set_constant_cache(constants);
+        }
+
+        Ciphertext mult(const Ciphertext &a, const Ciphertext &b)
+        {
+            Ciphertext result;
+            auto_evaluator_.multiply(a, b, result);
+            return result;
+        }
+
+        Ciphertext square(const Ciphertext &a)
+        {
+            Ciphertext result;
+            auto_evaluator_.square(a, result);
+            return result;
+        }
+
+        // 상수를 현재 레벨의 마지막 소수 q로 인코딩: rescale 후 스케일이 정확히 유지됨
+        Ciphertext multConst(const Ciphertext &a, double constant)
+        {
+            Ciphertext result;
+            auto_evaluator_.multiply_const(a, constant, result);
+            return result;
+        }
+
+        Ciphertext add(const Ciphertext &a, const Ciphertext &b)
+        {
+            Ciphertext result;
+            auto_evaluator_.add(a, b, result);
+            return result;
+        }
+
+        Ciphertext addConst(const Ciphertext &a, double constant)
+        {
+            Ciphertext result;
+            auto_evaluator_.add_const(a, constant, result);
+            return result;
+        }
+
+        Ciphertext negate(const Ciphertext &a)
+        {
+            Ciphertext result;
+            auto_evaluator_.negate(a, result);
+            return result;
+        }
+
+        // 복호화 전: 대기 중인 rescale, relinearize 수행
+        void finalize(Ciphertext &ct)
+        {
+            auto_evaluator_.finalize(ct);
+        }
+
+        AutoEvaluator &auto_evaluator()
+        {
+            return auto_evaluator_;
+        }
+
+    private:
+        AutoEvaluator auto_evaluator_;
+    };
+} // namespace seal
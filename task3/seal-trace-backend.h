@@ -0,0 +1,225 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT license.
+
+/*
+  SEAL CKKS backend for TracedCiphertext (task5/traced-ciphertext.h, 빌드 시 -I../task5 필요)
+  AutoEvaluator로 레벨, 스케일을 맞추므로 OpenFHE FLEXIBLEAUTO와 같은 회로 코드를 그대로 실행
+  - 암호문 handle은 std::shared_ptr<seal::Ciphertext>: TracedCiphertext의 memo, 공유 중 복제(copy-on-write)에 사용
+  - 곱셈 결과는 rescale 대기 상태로 두고, rescale()이나 다음 곱셈에서 rescale (OpenFHETraceBackend::rescale()과 같은 의미)
+  - rotate, decrypt 전에는 finalize()로 대기 중인 rescale, relinearize 수행
+  - 여러 index 회전: SEAL에는 hoisting API가 없으므로 finalize 한 번 후 index마다 rotate_vector
+  - info(): 레벨 = 처음 chain index와의 차이, noiseScaleDeg = round(log2(scale) / log2(Δ))
+  - AutoEvaluator의 통계를 잠금 없이 갱신하므로 한 스레드에서만 사용 (AsyncCiphertext에는 OpenFHETraceBackend)
+ */
+
+#pragma once
+
+#include "seal/seal.h"
+#include "seal-auto-evaluator.h"
+#include "traced-ciphertext.h"
+#include <cmath>
+#include <complex>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace seal
+{
+    class SEALTraceBackend
+    {
+    public:
+        using Ciphertext = std::shared_ptr<seal::Ciphertext>;
+
+        // galois_keys: 회로에서 사용하는 회전 step으로 생성 (TracedCiphertext::getRotationSteps() 참고)
+        SEALTraceBackend(
+            const SEALContext &context, const CKKSEncoder &encoder, const Encryptor &encryptor, Decryptor &decryptor,
+            const Evaluator &evaluator, const RelinKeys &relin_keys, const GaloisKeys &galois_keys, double scale)
+            : context_(context), encoder_(encoder), encryptor_(encryptor), decryptor_(decryptor),
+              evaluator_(evaluator), galois_keys_(galois_keys), scale_(scale),
+              auto_evaluator_(context, encoder, evaluator, relin_keys, scale)
+        {}
+
+        static const char *name()
+        {
+            return "SEAL";
+        }
+
+        // set_lazy_relinearization(), set_constant_cache(), stats()
+        AutoEvaluator &auto_evaluator()
+        {
+            return auto_evaluator_;
+        }
+
+        std::size_t slotCount() const
+        {
+            return encoder_.slot_count();
+        }
+
+        Ciphertext encrypt(const std::vector<std::complex<double>> &values)
+        {
+            Plaintext plain;
+            encoder_.encode(values, scale_, plain);
+            Ciphertext result = make();
+            encryptor_.encrypt(plain, *result);
+            return result;
+        }
+
+        std::vector<std::complex<double>> decrypt(const Ciphertext &ct)
+        {
+            seal::Ciphertext x = *ct;
+            auto_evaluator_.finalize(x);
+            Plaintext plain;
+            decryptor_.decrypt(x, plain);
+            std::vector<std::complex<double>> result;
+            encoder_.decode(plain, result);
+            return result;
+        }
+
+        Ciphertext clone(const Ciphertext &a)
+        {
+            return std::make_shared<seal::Ciphertext>(*a);
+        }
+
+        Ciphertext add(const Ciphertext &a, const Ciphertext &b)
+        {
+            Ciphertext result = make();
+            auto_evaluator_.add(*a, *b, *result);
+            return result;
+        }
+
+        Ciphertext addConst(const Ciphertext &a, double constant)
+        {
+            Ciphertext result = make();
+            auto_evaluator_.add_const(*a, constant, *result);
+            return result;
+        }
+
+        Ciphertext sub(const Ciphertext &a, const Ciphertext &b)
+        {
+            Ciphertext result = make();
+            auto_evaluator_.sub(*a, *b, *result);
+            return result;
+        }
+
+        Ciphertext negate(const Ciphertext &a)
+        {
+            Ciphertext result = make();
+            auto_evaluator_.negate(*a, *result);
+            return result;
+        }
+
+        void addInPlace(Ciphertext &a, const Ciphertext &b)
+        {
+            auto_evaluator_.add_inplace(*a, *b);
+        }
+
+        void addConstInPlace(Ciphertext &a, double constant)
+        {
+            seal::Ciphertext result;
+            auto_evaluator_.add_const(*a, constant, result);
+            *a = std::move(result);
+        }
+
+        Ciphertext mult(const Ciphertext &a, const Ciphertext &b)
+        {
+            Ciphertext result = make();
+            auto_evaluator_.multiply(*a, *b, *result);
+            return result;
+        }
+
+        Ciphertext square(const Ciphertext &a)
+        {
+            Ciphertext result = make();
+            auto_evaluator_.square(*a, *result);
+            return result;
+        }
+
+        Ciphertext multConst(const Ciphertext &a, double constant)
+        {
+            Ciphertext result = make();
+            auto_evaluator_.multiply_const(*a, constant, *result);
+            return result;
+        }
+
+        void multConstInPlace(Ciphertext &a, double constant)
+        {
+            seal::Ciphertext result;
+            auto_evaluator_.multiply_const(*a, constant, result);
+            *a = std::move(result);
+        }
+
+        // 항마다 multiply_const 후 합산. 모든 항이 같은 레벨 하나를 소모하므로 결과의 rescale은 한 번
+        Ciphertext linearWSum(const std::vector<Ciphertext> &terms, const std::vector<double> &weights)
+        {
+            Ciphertext result = make();
+            auto_evaluator_.multiply_const(*terms[0], weights[0], *result);
+            seal::Ciphertext term;
+            for (std::size_t i = 1; i < terms.size(); i++)
+            {
+                auto_evaluator_.multiply_const(*terms[i], weights[i], term);
+                auto_evaluator_.add_inplace(*result, term);
+            }
+            return result;
+        }
+
+        Ciphertext rotate(const Ciphertext &a, int step)
+        {
+            seal::Ciphertext x = *a;
+            auto_evaluator_.finalize(x);
+            Ciphertext result = make();
+            evaluator_.rotate_vector(x, step, galois_keys_, *result, auto_evaluator_.memory_pool());
+            return result;
+        }
+
+        std::vector<Ciphertext> rotate(const Ciphertext &a, const std::vector<std::int32_t> &steps)
+        {
+            seal::Ciphertext x = *a;
+            auto_evaluator_.finalize(x);
+            std::vector<Ciphertext> results;
+            results.reserve(steps.size());
+            for (std::int32_t step : steps)
+            {
+                Ciphertext result = make();
+                evaluator_.rotate_vector(x, step, galois_keys_, *result, auto_evaluator_.memory_pool());
+                results.push_back(std::move(result));
+            }
+            return results;
+        }
+
+        Ciphertext rescale(const Ciphertext &a)
+        {
+            if (!auto_evaluator_.is_pending(*a))
+                return a;
+            Ciphertext result = clone(a);
+            auto_evaluator_.rescale_if_pending(*result);
+            return result;
+        }
+
+        lbcrypto::TraceInfo info(const Ciphertext &ct) const
+        {
+            lbcrypto::TraceInfo info;
+            info.level = static_cast<std::uint32_t>(
+                context_.first_context_data()->chain_index() - context_.get_context_data(ct->parms_id())->chain_index());
+            info.noiseScaleDeg = static_cast<std::uint32_t>(std::lround(std::log2(ct->scale()) / std::log2(scale_)));
+            info.scalingFactor = ct->scale();
+            info.bytes = static_cast<std::uint64_t>(ct->size()) * ct->coeff_modulus_size() * ct->poly_modulus_degree() *
+                         sizeof(std::uint64_t);
+            return info;
+        }
+
+    private:
+        Ciphertext make() const
+        {
+            return std::make_shared<seal::Ciphertext>(auto_evaluator_.memory_pool());
+        }
+
+        const SEALContext &context_;
+        const CKKSEncoder &encoder_;
+        const Encryptor &encryptor_;
+        Decryptor &decryptor_;
+        const Evaluator &evaluator_;
+        const GaloisKeys &galois_keys_;
+        double scale_;
+        AutoEvaluator auto_evaluator_;
+    };
+} // namespace seal
@@ -42,6 +42,7 @@ using namespace lbcrypto;
 
 void AutomaticRescaleDemo(ScalingTechnique scalTech);
 void ManualRescaleDemo(ScalingTechnique scalTech);
+double HybridKeySwitchingDemo(ScalingTechnique scalTech, uint32_t dnum);
 
 int main(int argc, char* argv[]) {
 
@@ -102,33 +103,59 @@ void AutomaticRescaleDemo(ScalingTechnique scalTech) {
     result->SetLength(batchSize);
     std::cout << "(x+1)^2 * (x^2+2) = " << result << std::endl;
 
-    // Rotation - HybridKeySwitchingDemo1
-    parameters.SetNumLargeDigits(2);
-    std::cout << "- Using HYBRID key switching with " << 2 << " digits" << std::endl;
-    cc->EvalRotateKeyGen(keys.secretKey, {2});
+    // Rotation - HybridKeySwitchingDemo1, 2
+    // NumLargeDigits는 GenCryptoContext 이전에 설정해야 적용되므로, digit 수마다 context를 새로 생성해서 비교
+    double time2digits = HybridKeySwitchingDemo(scalTech, 2);
+    double time3digits = HybridKeySwitchingDemo(scalTech, 3);
+    std::cout << "---------- rotations with HYBRID: 2 digits " << time2digits << "ms, 3 digits " << time3digits << "ms"
+              << std::endl;
+}
 
-    TimeVar t;
-    TIC(t);
-    auto cRot2         = cc->EvalRotate(cRes, 2);
-    double time2digits = TOC(t);
+double HybridKeySwitchingDemo(ScalingTechnique scalTech, uint32_t dnum) {
 
-    cc->Decrypt(keys.secretKey, cRot2, &result);
-    result->SetLength(batchSize);
-    std::cout << "x left rotate 2 = " << result << std::endl;
-    std::cout << "---------- rotations with HYBRID (2 digits) took " << time2digits << "ms" << std::endl << std::endl;;
+    std::cout << "- Using HYBRID key switching with " << dnum << " digits" << std::endl;
+
+    uint32_t batchSize = 8;
+    CCParams<CryptoContextCKKSRNS> parameters;
+    parameters.SetMultiplicativeDepth(5);
+    parameters.SetScalingModSize(50);
+    parameters.SetScalingTechnique(scalTech);
+    parameters.SetBatchSize(batchSize);
+    parameters.SetKeySwitchTechnique(HYBRID);
+    parameters.SetNumLargeDigits(dnum);
+
+    CryptoContext<DCRTPoly> cc = GenCryptoContext(parameters);
+
+    cc->Enable(PKE);
+    cc->Enable(KEYSWITCH);
+    cc->Enable(LEVELEDSHE);
+
+    auto keys = cc->KeyGen();
+    cc->EvalMultKeyGen(keys.secretKey);
+    cc->EvalRotateKeyGen(keys.secretKey, {2});
+
+    std::vector<double> x = {1.0, 1.01, 1.02, 1.03, 1.04, 1.05, 1.06, 1.07};
+    Plaintext ptxt        = cc->MakeCKKSPackedPlaintext(x);
 
-    // Rotation - HybridKeySwitchingDemo2
-    parameters.SetNumLargeDigits(3);
-    std::cout << "- Using HYBRID key switching with " << 3 << " digits" << std::endl;
+    auto c = cc->Encrypt(ptxt, keys.publicKey);
+    auto cplus1 = cc->EvalAdd(c, 1);                     // x+1
+    auto cplus1_2 = cc->EvalMult(cplus1, cplus1);        // (x+1)^2
+    auto c2   = cc->EvalMult(c, c);                      // x^2
+    auto c2plus2 = cc->EvalAdd(c2, 2);                   // (x^2+2)
+    auto cRes = cc->EvalMult(cplus1_2, c2plus2);         // Final result
 
+    TimeVar t;
     TIC(t);
-    auto cRot2_2 = cc->EvalRotate(cRes, 2);
-    double time3digits = TOC(t);    // The runtime here is smaller than in the previous demo.
+    auto cRot2  = cc->EvalRotate(cRes, 2);
+    double time = TOC(t);
 
-    cc->Decrypt(keys.secretKey, cRot2_2, &result);
+    Plaintext result;
+    std::cout.precision(8);
+    cc->Decrypt(keys.secretKey, cRot2, &result);
     result->SetLength(batchSize);
     std::cout << "x left rotate 2 = " << result << std::endl;
-    std::cout << "---------- rotations with HYBRID (3 digits) took " << time3digits << "ms" << std::endl;
+    std::cout << "---------- rotations with HYBRID (" << dnum << " digits) took " << time << "ms" << std::endl << std::endl;
+    return time;
 }
 
 void ManualRescaleDemo(ScalingTechnique scalTech) {
@@ -185,9 +212,7 @@ void ManualRescaleDemo(ScalingTechnique scalTech) {
     result->SetLength(batchSize);
     std::cout << "(x+1)^2 * (x^2+2) = " << result << std::endl;
 
-    // Rotation - HybridKeySwitchingDemo1
-    parameters.SetNumLargeDigits(2);
-    std::cout << "- Using HYBRID key switching with " << 2 << " digits" << std::endl;
+    // Rotation
     cc->EvalRotateKeyGen(keys.secretKey, {2});
 
     auto cRot2         = cc->EvalRotate(cRes_depth1, 2);
@@ -0,0 +1,198 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Async TracedCiphertext
+  AsyncTraceCircuit::input()으로 입력을 넣고 cipherAdd, cipherMult ... 를 호출하면 결과를 기다리지 않고 AsyncCiphertext handle을 반환.
+  연산은 피연산자가 준비되는 대로 AsyncGraph(async-graph.h)의 worker에서 실행되므로 독립된 가지가 동시에 계산됨
+  - 추적(DAG 기록, 정책에 따른 검증, memo)은 TracedCiphertext 그대로. 기록 순서는 실행 순서이므로 위상 순서가 유지됨
+  - Backend의 연산이 여러 스레드에서 호출 가능해야 함: AsyncTraceCircuit<OpenFHETraceBackend<DCRTPoly>> (SEALTraceBackend는 불가)
+  - OpenFHE 연산 내부의 OpenMP와 겹치지 않도록 worker마다 omp_set_num_threads(cores / workers) (openfhe-batch-executor.h와 같음)
+  - 결과는 get()으로 기다려서 꺼냄. finish(), checkpoint()처럼 결과를 바꾸는 메소드는 get()한 값의 복사본에서 호출
+ */
+
+#ifndef LBCRYPTO_TRACE_ASYNC_CIPHERTEXT_H
+#define LBCRYPTO_TRACE_ASYNC_CIPHERTEXT_H
+
+#include "async-graph.h"
+#include "traced-ciphertext.h"
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
+namespace lbcrypto {
+
+template <typename Backend>
+class AsyncTraceCircuit;
+
+// ------------------------------- AsyncCiphertext
+template <typename Backend>
+class AsyncCiphertext {
+private:
+    using Value = TracedCiphertext<Backend>;
+
+    AsyncTraceCircuit<Backend>* circuit = nullptr;
+    AsyncValue<Value> value;
+
+    friend class AsyncTraceCircuit<Backend>;
+
+    AsyncCiphertext(AsyncTraceCircuit<Backend>* circuit, AsyncValue<Value> value)
+        : circuit(circuit), value(std::move(value)) {}
+
+    template <typename Fn>
+    AsyncCiphertext unary(Fn fn) const {
+        return circuit->schedule({value}, [fn](const std::vector<const Value*>& args) { return fn(*args[0]); });
+    }
+
+    template <typename Fn>
+    AsyncCiphertext binary(const AsyncCiphertext& other, Fn fn) const {
+        return circuit->schedule({value, other.value},
+                                 [fn](const std::vector<const Value*>& args) { return fn(*args[0], *args[1]); });
+    }
+
+public:
+    AsyncCiphertext() = default;
+
+    bool ready() const {
+        return value.ready();
+    }
+
+    void wait() const {
+        value.wait();
+    }
+
+    const TracedCiphertext<Backend>& get() const {
+        return value.get();
+    }
+
+    AsyncCiphertext cipherAdd(double constant) const {
+        return unary([constant](const Value& a) { return a.cipherAdd(constant); });
+    }
+
+    AsyncCiphertext cipherAdd(const AsyncCiphertext& other) const {
+        return binary(other, [](const Value& a, const Value& b) { return a.cipherAdd(b); });
+    }
+
+    AsyncCiphertext cipherMult(double constant) const {
+        return unary([constant](const Value& a) { return a.cipherMult(constant); });
+    }
+
+    AsyncCiphertext cipherMult(const AsyncCiphertext& other) const {
+        return binary(other, [](const Value& a, const Value& b) { return a.cipherMult(b); });
+    }
+
+    AsyncCiphertext cipherSquare() const {
+        return unary([](const Value& a) { return a.cipherSquare(); });
+    }
+
+    AsyncCiphertext cipherRotate(int32_t index) const {
+        return unary([index](const Value& a) { return a.cipherRotate(index); });
+    }
+
+    // sum_i weights[i] * terms[i] + constant. 모든 항이 준비되면 한 노드에서 cipherLinearWSum
+    static AsyncCiphertext cipherLinearWSum(const std::vector<AsyncCiphertext>& terms, std::vector<double> weights,
+                                            double constant = 0) {
+        if (terms.empty())
+            throw std::invalid_argument("AsyncCiphertext: empty linear sum");
+        std::vector<AsyncValue<Value>> args;
+        for (const auto& term : terms)
+            args.push_back(term.value);
+        return terms[0].circuit->schedule(args, [weights, constant](const std::vector<const Value*>& values) {
+            return Value::cipherLinearWSum(values, weights, constant);
+        });
+    }
+};
+
+// ------------------------------- AsyncTraceCircuit
+template <typename Backend>
+class AsyncTraceCircuit {
+private:
+    using Value = TracedCiphertext<Backend>;
+
+    uint32_t ompThreadsPerWorker;
+    AsyncGraph<Value> graph;
+
+    friend class AsyncCiphertext<Backend>;
+
+    AsyncCiphertext<Backend> schedule(const std::vector<AsyncValue<Value>>& args,
+                                      std::function<Value(const std::vector<const Value*>&)> fn) {
+        const uint32_t ompThreads = ompThreadsPerWorker;
+        return AsyncCiphertext<Backend>(
+            this, graph.then(args, [fn = std::move(fn), ompThreads](const std::vector<const Value*>& values, size_t) {
+#ifdef _OPENMP
+                omp_set_num_threads(static_cast<int>(ompThreads));   // 이 스레드의 parallel region에만 적용
+#else
+                (void)ompThreads;
+#endif
+                return fn(values);
+            }));
+    }
+
+public:
+    // ompThreadsPerWorker = 0: 전체 코어 수를 worker 수로 나눈 값 (최소 1)
+    explicit AsyncTraceCircuit(size_t numWorkers = std::thread::hardware_concurrency(), uint32_t ompThreadsPerWorker = 0)
+        : ompThreadsPerWorker(ompThreadsPerWorker), graph(numWorkers) {
+        if (this->ompThreadsPerWorker == 0) {
+            size_t cores              = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+            this->ompThreadsPerWorker = static_cast<uint32_t>(std::max<size_t>(cores / graph.getNumThreads(), 1));
+        }
+    }
+
+    // 회로 입력. 같은 TracedCiphertext에서 파생된 결과는 추적 상태(recorder, 정책, memo)를 공유
+    AsyncCiphertext<Backend> input(const TracedCiphertext<Backend>& tc) {
+        return AsyncCiphertext<Backend>(this, graph.ready(tc));
+    }
+
+    size_t getNumWorkers() const {
+        return graph.getNumThreads();
+    }
+
+    uint32_t getOmpThreadsPerWorker() const {
+        return ompThreadsPerWorker;
+    }
+
+    size_t getMaxParallelism() const {
+        return graph.getMaxParallelism();
+    }
+
+    size_t getExecutedCount() const {
+        return graph.getExecutedCount();
+    }
+};
+
+}  // namespace lbcrypto
+
+#endif
@@ -0,0 +1,242 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Dependency-driven async execution on WorkStealingPool
+  연산마다 AsyncValue(결과 handle)를 바로 반환하고, 피연산자가 모두 준비된 노드부터 pool에서 실행
+  서로 의존하지 않는 가지(예: (x+1)^2와 x^2+2)는 다른 worker에서 동시에 실행되어 요청 하나의 지연시간이 줄어듦
+  - 준비된 피연산자만 있는 노드는 만들자마자 submit. 나머지는 마지막 피연산자가 끝난 worker가 submit
+  - 피연산자에서 난 예외는 결과 쪽으로 전파되어 get()에서 다시 던짐
+  - compute 안에서 다른 handle의 get()/wait()를 호출하면 안 됨 (worker가 모두 기다리면 deadlock)
+ */
+
+#ifndef LBCRYPTO_TRACE_ASYNC_GRAPH_H
+#define LBCRYPTO_TRACE_ASYNC_GRAPH_H
+
+#include "work-stealing-pool.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace lbcrypto {
+
+template <typename T>
+class AsyncGraph;
+
+// ------------------------------- AsyncNode
+template <typename T>
+struct AsyncNode {
+    using Compute = std::function<T(const std::vector<const T*>& args, size_t worker)>;
+
+    std::vector<std::shared_ptr<AsyncNode>> args;   // 실행이 끝나면 해제
+    Compute compute;
+    std::atomic<size_t> waiting{0};                 // 끝나지 않은 피연산자 수 + 1 (등록 중)
+
+    std::mutex mtx;
+    std::condition_variable cv;
+    bool done = false;
+    std::optional<T> value;
+    std::exception_ptr error;
+    std::vector<std::shared_ptr<AsyncNode>> dependents;  // 이 노드를 기다리는 노드
+};
+
+// ------------------------------- AsyncValue
+// 아직 계산 중일 수 있는 결과. 복사하면 같은 노드를 가리킴
+template <typename T>
+class AsyncValue {
+private:
+    std::shared_ptr<AsyncNode<T>> node;
+
+    friend class AsyncGraph<T>;
+
+    explicit AsyncValue(std::shared_ptr<AsyncNode<T>> node) : node(std::move(node)) {}
+
+public:
+    AsyncValue() = default;
+
+    bool valid() const {
+        return node != nullptr;
+    }
+
+    bool ready() const {
+        std::lock_guard<std::mutex> lock(node->mtx);
+        return node->done;
+    }
+
+    void wait() const {
+        std::unique_lock<std::mutex> lock(node->mtx);
+        node->cv.wait(lock, [this] { return node->done; });
+    }
+
+    // 결과를 기다려서 반환. 실행 중 예외가 났으면 다시 던짐
+    const T& get() const {
+        wait();
+        if (node->error)
+            std::rethrow_exception(node->error);
+        return *node->value;
+    }
+};
+
+// ------------------------------- AsyncGraph
+template <typename T>
+class AsyncGraph {
+public:
+    using Compute = typename AsyncNode<T>::Compute;
+
+private:
+    using Node = AsyncNode<T>;
+
+    std::atomic<size_t> executed{0};
+    std::atomic<size_t> running{0};
+    std::atomic<size_t> maxRunning{0};
+    WorkStealingPool pool;  // 마지막 멤버: 소멸할 때 남은 작업을 모두 실행한 뒤 다른 멤버가 해제됨
+
+    void submit(std::shared_ptr<Node> node) {
+        pool.submit([this, node](size_t worker) { run(node, worker); });
+    }
+
+    void release(const std::shared_ptr<Node>& node) {
+        if (--node->waiting == 0)
+            submit(node);
+    }
+
+    void run(const std::shared_ptr<Node>& node, size_t worker) {
+        const size_t now = ++running;
+        size_t peak      = maxRunning;
+        while (now > peak && !maxRunning.compare_exchange_weak(peak, now)) {
+        }
+
+        std::optional<T> value;
+        std::exception_ptr error;
+        std::vector<const T*> args;
+        for (const auto& arg : node->args) {
+            if (arg->error && !error)
+                error = arg->error;
+            args.push_back(arg->value ? &*arg->value : nullptr);
+        }
+        if (!error) {
+            try {
+                value.emplace(node->compute(args, worker));
+            }
+            catch (...) {
+                error = std::current_exception();
+            }
+        }
+        node->args.clear();
+        node->compute = nullptr;
+        --running;
+        executed++;
+        complete(node, std::move(value), error);
+    }
+
+    void complete(const std::shared_ptr<Node>& node, std::optional<T> value, std::exception_ptr error) {
+        std::vector<std::shared_ptr<Node>> dependents;
+        {
+            std::lock_guard<std::mutex> lock(node->mtx);
+            if (value)
+                node->value.emplace(std::move(*value));
+            node->error = error;
+            node->done  = true;
+            dependents.swap(node->dependents);
+        }
+        node->cv.notify_all();
+        for (const auto& dependent : dependents)
+            release(dependent);
+    }
+
+public:
+    explicit AsyncGraph(size_t numThreads = std::thread::hardware_concurrency()) : pool(numThreads) {}
+
+    AsyncGraph(const AsyncGraph&)            = delete;
+    AsyncGraph& operator=(const AsyncGraph&) = delete;
+
+    size_t getNumThreads() const {
+        return pool.size();
+    }
+
+    size_t getStealCount() const {
+        return pool.getStealCount();
+    }
+
+    size_t getExecutedCount() const {
+        return executed;
+    }
+
+    // 동시에 실행된 노드 수의 최댓값 (회로에서 실제로 얻은 병렬성)
+    size_t getMaxParallelism() const {
+        return maxRunning;
+    }
+
+    // 이미 준비된 값 (회로 입력)
+    AsyncValue<T> ready(T value) {
+        auto node = std::make_shared<Node>();
+        node->value.emplace(std::move(value));
+        node->done = true;
+        return AsyncValue<T>(std::move(node));
+    }
+
+    // args가 모두 준비되면 compute(args의 결과, worker 번호)를 실행하는 노드. 바로 반환
+    AsyncValue<T> then(const std::vector<AsyncValue<T>>& args, Compute compute) {
+        auto node     = std::make_shared<Node>();
+        node->compute = std::move(compute);
+        node->waiting = args.size() + 1;
+        for (const auto& arg : args) {
+            if (!arg.valid())
+                throw std::invalid_argument("AsyncGraph: operand has no value");
+            node->args.push_back(arg.node);
+        }
+        for (const auto& arg : node->args) {
+            std::unique_lock<std::mutex> lock(arg->mtx);
+            if (arg->done) {
+                lock.unlock();
+                --node->waiting;
+            }
+            else {
+                arg->dependents.push_back(node);
+            }
+        }
+        release(node);
+        return AsyncValue<T>(std::move(node));
+    }
+};
+
+}  // namespace lbcrypto
+
+#endif
@@ -0,0 +1,544 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Static scale/level budget analyzer
+  기록된 회로(TraceNode)를 키, 암호문 없이 따라가면서 노드마다 레벨, noiseScaleDeg, 정확한 스케일,
+  값 크기 상한, 추정 오차를 계산. 레벨 부족, 스케일 overflow, 레벨/스케일 불일치, 정밀도 부족을 키 생성 전에 찾음
+  - AUTO: OpenFHE FLEXIBLEAUTO(SEAL AutoEvaluator) 규칙. 곱셈 피연산자는 필요할 때만 rescale, 레벨은 높은 쪽으로 맞춤
+  - MANUAL: SEAL Evaluator를 직접 쓰는 코드(task3/my_ckks_prac.cpp). rescale은 cipherRescale 노드에서만,
+    덧셈은 레벨과 스케일이, 곱셈은 레벨이 같아야 함. 상수는 encode(value, scale, plain)처럼 맨 위 레벨, 스케일 Δ로 인코딩된다고 봄
+  - 오차는 평균적인 경우의 잡음 분산에 6σ를 곱한 추정치 (fresh, rescale 반올림, key switching). 최종 판단은 실행(PrecisionAnalyzer)
+ */
+
+#ifndef LBCRYPTO_TRACE_BUDGET_ANALYZER_H
+#define LBCRYPTO_TRACE_BUDGET_ANALYZER_H
+
+#include "trace-recorder.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace lbcrypto {
+
+enum class RescaleMode { AUTO, MANUAL };
+
+// ------------------------------- ModulusChain
+// 레벨 l의 암호문은 q_0 .. q_{L-l}을 가짐 (L = depth). rescale하면 q_{L-l}이 빠짐
+struct ModulusChain {
+    uint32_t ringDim = 0;
+    std::vector<double> primes;  // q_0 (first mod) .. q_L (scaling primes). special prime(P)은 제외
+    double scale = 0;            // 입력 암호문의 스케일 Δ. 0이면 q_L (FLEXIBLEAUTO)
+
+    // 소수를 2^bits로 근사: 실제 소수 없이 CKKSParams만으로 분석
+    static ModulusChain fromBits(uint32_t ringDim, uint32_t firstModSize, uint32_t scalingModSize, uint32_t depth) {
+        ModulusChain chain;
+        chain.ringDim = ringDim;
+        chain.primes.assign(depth + 1, std::exp2(scalingModSize));
+        chain.primes[0] = std::exp2(firstModSize);
+        return chain;
+    }
+
+    // 실제 소수 (SEAL: context.first_context_data()->parms().coeff_modulus(), OpenFHE: GetElementParams()->GetParams())
+    // 키 생성 없이 얻을 수 있고, 소수가 2^bits와 달라 생기는 스케일 drift까지 계산됨
+    static ModulusChain fromPrimes(uint32_t ringDim, const std::vector<uint64_t>& primes, double scale = 0) {
+        if (primes.empty())
+            throw std::invalid_argument("ModulusChain: empty modulus chain");
+        ModulusChain chain;
+        chain.ringDim = ringDim;
+        for (uint64_t q : primes)
+            chain.primes.push_back(static_cast<double>(q));
+        chain.scale = scale;
+        return chain;
+    }
+
+    uint32_t depth() const {
+        return primes.empty() ? 0 : static_cast<uint32_t>(primes.size() - 1);
+    }
+
+    double logQ(uint32_t level) const {
+        double sum = 0;
+        for (uint32_t i = 0; i + level <= depth(); ++i)
+            sum += std::log2(primes[i]);
+        return sum;
+    }
+
+    // SEAL의 chain_index (맨 위 레벨이 depth, 마지막 레벨이 0)
+    uint32_t chainIndex(uint32_t level) const {
+        return level <= depth() ? depth() - level : 0;
+    }
+};
+
+// ------------------------------- BudgetNode
+struct BudgetNode {
+    uint64_t id = 0;
+    std::string op;
+    uint32_t level         = 0;
+    uint32_t noiseScaleDeg = 1;
+    double scale           = 0;  // 정확한 스케일 (SEAL Ciphertext::scale()처럼 double 곱셈, 나눗셈으로 계산)
+    double logMagnitude    = 0;  // 값의 크기 상한 (log2)
+    double logError        = 0;  // 추정 절대 오차 (log2)
+    double headroomBits    = 0;  // log2 Q_level - log2(스케일 * 크기) - 1. 음수면 복호화 결과가 modulus를 넘어감
+
+    double logScale() const {
+        return std::log2(scale);
+    }
+
+    double precisionBits() const {
+        return -logError;
+    }
+};
+
+struct BudgetIssue {
+    uint64_t node = 0;
+    std::string op;
+    std::string message;
+};
+
+// ------------------------------- BudgetReport
+struct BudgetReport {
+    std::vector<BudgetNode> nodes;  // nodes[i]: i + 1번 노드
+    std::vector<BudgetIssue> issues;
+    std::vector<uint64_t> outputs;  // 다른 노드의 피연산자로 쓰이지 않는 노드
+    uint32_t levelsUsed     = 0;
+    uint32_t levelsTotal    = 0;
+    double precisionBits    = std::numeric_limits<double>::infinity();  // 출력 노드 중 가장 낮은 추정 정밀도
+    double minHeadroomBits  = std::numeric_limits<double>::infinity();
+    double analysisUs       = 0;
+
+    bool feasible() const {
+        return issues.empty();
+    }
+
+    // 첫 번째 문제 한 줄 (없으면 빈 문자열)
+    std::string summary() const {
+        if (issues.empty())
+            return "";
+        return "node " + std::to_string(issues[0].node) + " " + issues[0].op + ": " + issues[0].message;
+    }
+
+    void print(std::ostream& out = std::cout, bool perNode = true) const {
+        const auto flags = out.flags();
+        out << std::fixed << std::setprecision(2);
+        if (perNode) {
+            out << std::setw(6) << "id" << "  " << std::left << std::setw(22) << "op" << std::right << std::setw(7)
+                << "level" << std::setw(5) << "deg" << std::setw(10) << "log2(s)" << std::setw(10) << "headroom"
+                << std::setw(8) << "bits" << std::endl;
+            for (const auto& n : nodes) {
+                out << std::setw(6) << n.id << "  " << std::left << std::setw(22) << n.op << std::right << std::setw(7)
+                    << n.level << std::setw(5) << n.noiseScaleDeg << std::setw(10) << n.logScale() << std::setw(10)
+                    << n.headroomBits << std::setw(8) << n.precisionBits() << std::endl;
+            }
+        }
+        for (const auto& issue : issues)
+            out << "  node " << issue.node << " " << issue.op << ": " << issue.message << std::endl;
+        out << (feasible() ? "feasible" : "infeasible") << ": levels " << levelsUsed << "/" << levelsTotal
+            << ", min headroom " << minHeadroomBits << " bits, estimated precision " << precisionBits << " bits ("
+            << analysisUs << " us)" << std::endl;
+        out.flags(flags);
+    }
+};
+
+// ------------------------------- BudgetAnalyzer
+class BudgetAnalyzer {
+private:
+    static constexpr double SIGMA = 3.19;  // 오차 분포 표준편차 (OpenFHE, SEAL 기본값)
+    static constexpr double TAIL  = 6;     // 추정 상한 = TAIL * 표준편차
+    static constexpr double NEG_INF = -std::numeric_limits<double>::infinity();
+
+    ModulusChain chain;
+    RescaleMode mode;
+    double inputMagnitude = 1;
+    double requiredBits   = 0;
+    std::vector<double> autoScales;  // AUTO: 레벨별 스케일. s_0 = Δ, s_{l+1} = s_l^2 / q_{L-l} (OpenFHE FLEXIBLEAUTO)
+
+    // log2(2^a + 2^b)
+    static double logSum(double a, double b) {
+        if (a == NEG_INF)
+            return b;
+        if (b == NEG_INF)
+            return a;
+        const double hi = std::max(a, b);
+        return hi + std::log2(1 + std::exp2(std::min(a, b) - hi));
+    }
+
+    static double logAbs(double value) {
+        return value == 0 ? NEG_INF : std::log2(std::fabs(value));
+    }
+
+    // 새로 암호화한 암호문의 잡음: 슬롯마다 분산 N * σ^2 * (4N/3 + 1) (ternary 비밀키, e0 + e1*s + v*e)
+    double freshNoise() const {
+        const double n = chain.ringDim;
+        return std::log2(TAIL * SIGMA * std::sqrt(n * (4.0 * n / 3 + 1)));
+    }
+
+    // rescale 반올림 잡음: 분산 N * (1 + h) / 12, h = 2N/3. key switching 후 P로 나눌 때도 같은 크기
+    double roundingNoise() const {
+        const double n = chain.ringDim;
+        return std::log2(TAIL * std::sqrt(n * (1 + 2.0 * n / 3) / 12));
+    }
+
+    double autoScale(uint32_t level, uint32_t deg) const {
+        const double s = autoScales[std::min<size_t>(level, autoScales.size() - 1)];
+        return deg > 1 ? s * s : s;
+    }
+
+    std::string levelName(uint32_t level) const {
+        return "level " + std::to_string(level) + " (chain index " + std::to_string(chain.chainIndex(level)) + ")";
+    }
+
+    static std::string bits(double logValue) {
+        std::ostringstream os;
+        os << std::fixed << std::setprecision(2) << "2^" << logValue;
+        return os.str();
+    }
+
+    // 2^50 근처 소수로 나눈 스케일은 log2로는 구별되지 않으므로 정확한 값도 함께 표시
+    static std::string exact(double scale) {
+        std::ostringstream os;
+        os << std::setprecision(17) << scale << " (" << bits(std::log2(scale)) << ")";
+        return os.str();
+    }
+
+    // SEAL은 두 스케일이 double 반올림 오차 안에서 같아야 덧셈을 허용
+    static bool sameScale(double a, double b) {
+        return std::fabs(a - b) <= 1e-12 * std::max(a, b);
+    }
+
+    struct Context {
+        const TraceNode& node;
+        BudgetReport& report;
+        bool reported = false;
+
+        void issue(const std::string& message) {
+            if (!reported)
+                report.issues.push_back({node.id, node.op, message});
+            reported = true;
+        }
+    };
+
+    // 가장 마지막 소수를 나눔. 남은 소수가 하나뿐이면 레벨 부족
+    void rescale(BudgetNode& x, Context& ctx) const {
+        if (x.level >= chain.depth()) {
+            ctx.issue("out of levels: rescale at " + levelName(x.level) + " needs multiplicative depth " +
+                      std::to_string(x.level + 1) + " > " + std::to_string(chain.depth()));
+            x.noiseScaleDeg = std::max<uint32_t>(1, x.noiseScaleDeg - 1);
+            return;
+        }
+        const double q = chain.primes[chain.depth() - x.level];
+        x.level++;
+        x.noiseScaleDeg = std::max<uint32_t>(1, x.noiseScaleDeg - 1);
+        x.scale         = mode == RescaleMode::AUTO ? autoScale(x.level, x.noiseScaleDeg) : x.scale / q;
+        x.logError      = logSum(x.logError, roundingNoise() - x.logScale());
+    }
+
+    // AUTO: 곱셈 전에 대기 중인 rescale 수행
+    void prepare(BudgetNode& x, Context& ctx) const {
+        if (mode == RescaleMode::AUTO && x.noiseScaleDeg > 1)
+            rescale(x, ctx);
+    }
+
+    // 피연산자의 레벨(AUTO: 높은 쪽으로 맞춤), 스케일(MANUAL: 같아야 함) 정렬. 결과의 레벨, deg, 스케일을 반환
+    BudgetNode align(std::vector<BudgetNode> xs, bool needSameScale, Context& ctx) const {
+        BudgetNode hi = xs[0];
+        for (const auto& x : xs) {
+            if (x.level > hi.level || (x.level == hi.level && x.noiseScaleDeg > hi.noiseScaleDeg))
+                hi = x;
+        }
+        for (const auto& x : xs) {
+            if (mode == RescaleMode::MANUAL) {
+                if (x.level != hi.level)
+                    ctx.issue("level mismatch: node " + std::to_string(x.id) + " is at " + levelName(x.level) +
+                              ", node " + std::to_string(hi.id) + " at " + levelName(hi.level) +
+                              " (mod switch node " + std::to_string(x.id) + " down " +
+                              std::to_string(hi.level - x.level) + " level(s))");
+                else if (needSameScale && !sameScale(x.scale, hi.scale))
+                    ctx.issue("scale mismatch: node " + std::to_string(x.id) + " has scale " + exact(x.scale) +
+                              ", node " + std::to_string(hi.id) + " has " + exact(hi.scale));
+            }
+        }
+        BudgetNode r = hi;
+        if (mode == RescaleMode::AUTO)
+            r.scale = autoScale(r.level, r.noiseScaleDeg);
+        r.logMagnitude = NEG_INF;
+        r.logError     = NEG_INF;
+        return r;
+    }
+
+    // MANUAL: 상수 plaintext는 맨 위 레벨, 스케일 Δ. 필요한 레벨과 스케일을 알려 줌
+    void checkConstant(const BudgetNode& x, bool needSameScale, Context& ctx) const {
+        if (mode != RescaleMode::MANUAL)
+            return;
+        const bool levelOk = x.level == 0;
+        const bool scaleOk = !needSameScale || sameScale(x.scale, inputScale());
+        if (levelOk && scaleOk)
+            return;
+        std::string message = "constant encoded at " + levelName(0) + " with scale " + exact(inputScale()) +
+                              " must be at " + levelName(x.level);
+        if (needSameScale)
+            message += " with scale " + exact(x.scale);
+        if (!levelOk)
+            message += " (mod switch the plaintext down " + std::to_string(x.level) + " level(s))";
+        ctx.issue(message);
+    }
+
+    double inputScale() const {
+        return chain.scale > 0 ? chain.scale : chain.primes.back();
+    }
+
+    BudgetNode evaluate(const TraceNode& n, const std::vector<BudgetNode>& state, Context& ctx) const {
+        auto arg = [&](size_t i) { return state.at(n.operands.at(i)); };
+        static const std::string rotatePrefix = "cipherRotate(";
+        BudgetNode r;
+
+        if (n.op == "input") {
+            r.scale        = mode == RescaleMode::AUTO ? autoScale(0, 1) : inputScale();
+            r.logMagnitude = logAbs(inputMagnitude);
+            r.logError     = freshNoise() - r.logScale();
+        }
+        else if (n.op == "cipherAdd(const)") {
+            r = arg(0);
+            checkConstant(r, true, ctx);
+            r.logMagnitude = logSum(r.logMagnitude, logAbs(n.constant));
+            r.logError     = logSum(r.logError, -r.logScale() - 1);
+        }
+        else if (n.op == "cipherAdd" || n.op == "cipherSub") {
+            BudgetNode a = arg(0), b = arg(1);
+            r              = align({a, b}, true, ctx);
+            r.logMagnitude = logSum(a.logMagnitude, b.logMagnitude);
+            r.logError     = logSum(a.logError, b.logError);
+            if (mode == RescaleMode::AUTO && a.level != b.level)  // 낮은 레벨 쪽을 상수 곱셈, rescale로 맞춤
+                r.logError = logSum(r.logError, roundingNoise() - r.logScale());
+        }
+        else if (n.op == "cipherMult" || n.op == "cipherSquare") {
+            BudgetNode a = arg(0), b = n.op == "cipherSquare" ? a : arg(1);
+            prepare(a, ctx);
+            prepare(b, ctx);
+            r = align({a, b}, false, ctx);
+            r.noiseScaleDeg = mode == RescaleMode::AUTO ? 2 : a.noiseScaleDeg + b.noiseScaleDeg;
+            r.scale         = mode == RescaleMode::AUTO ? autoScale(r.level, 2) : a.scale * b.scale;
+            r.logMagnitude  = a.logMagnitude + b.logMagnitude;
+            r.logError      = logSum(logSum(a.logMagnitude + b.logError, b.logMagnitude + a.logError),
+                                     logSum(a.logError + b.logError, roundingNoise() - r.logScale()));
+        }
+        else if (n.op == "cipherMult(const)") {
+            BudgetNode a = arg(0);
+            prepare(a, ctx);
+            checkConstant(a, false, ctx);
+            const double constScale = mode == RescaleMode::AUTO ? autoScale(a.level, 1) : inputScale();
+            r                       = a;
+            r.noiseScaleDeg++;
+            r.scale        = mode == RescaleMode::AUTO ? autoScale(r.level, 2) : a.scale * constScale;
+            r.logMagnitude = a.logMagnitude + logAbs(n.constant);
+            r.logError     = logSum(a.logError + logAbs(n.constant), a.logMagnitude - std::log2(constScale) - 1);
+        }
+        else if (n.op == "cipherLinearWSum") {
+            std::vector<BudgetNode> xs;
+            for (size_t i = 0; i < n.operands.size(); ++i) {
+                xs.push_back(arg(i));
+                prepare(xs.back(), ctx);
+            }
+            r                       = align(xs, true, ctx);
+            const double constScale = mode == RescaleMode::AUTO ? autoScale(r.level, 1) : inputScale();
+            for (size_t i = 0; i < xs.size(); ++i) {
+                const double w = logAbs(n.weights.at(i));
+                r.logMagnitude = logSum(r.logMagnitude, xs[i].logMagnitude + w);
+                r.logError     = logSum(r.logError,
+                                        logSum(xs[i].logError + w, xs[i].logMagnitude - std::log2(constScale) - 1));
+            }
+            r.noiseScaleDeg++;
+            r.scale        = mode == RescaleMode::AUTO ? autoScale(r.level, 2) : r.scale * constScale;
+            r.logMagnitude = logSum(r.logMagnitude, logAbs(n.constant));
+        }
+        else if (n.op == "cipherNegate") {
+            r = arg(0);
+        }
+        else if (n.op == "cipherRescale") {
+            r = arg(0);
+            if (mode == RescaleMode::MANUAL || r.noiseScaleDeg > 1)
+                rescale(r, ctx);
+        }
+        else if (n.op.compare(0, rotatePrefix.size(), rotatePrefix) == 0) {
+            r          = arg(0);
+            r.logError = logSum(r.logError, roundingNoise() - r.logScale());
+        }
+        else {
+            ctx.issue("unsupported op");
+            if (!n.operands.empty())
+                r = arg(0);
+        }
+        return r;
+    }
+
+public:
+    // mode: AUTO(FLEXIBLEAUTO, AutoEvaluator, TracedCiphertext) 또는 MANUAL(SEAL Evaluator 직접 사용)
+    explicit BudgetAnalyzer(ModulusChain modulusChain, RescaleMode mode = RescaleMode::AUTO)
+        : chain(std::move(modulusChain)), mode(mode) {
+        if (chain.primes.empty() || chain.ringDim == 0)
+            throw std::invalid_argument("BudgetAnalyzer: modulus chain needs primes and a ring dimension");
+        autoScales.push_back(inputScale());
+        for (uint32_t l = 0; l < chain.depth(); ++l)
+            autoScales.push_back(autoScales.back() * autoScales.back() / chain.primes[chain.depth() - l]);
+    }
+
+    // 입력 슬롯 값의 절댓값 상한 (기본 1). 값의 크기로 headroom과 곱셈 오차 증폭을 계산
+    void setInputMagnitude(double magnitude) {
+        inputMagnitude = magnitude;
+    }
+
+    // 출력 노드의 추정 정밀도가 이 값보다 낮으면 문제로 기록 (0: 검사 안 함)
+    void setRequiredBits(double bits) {
+        requiredBits = bits;
+    }
+
+    const ModulusChain& getModulusChain() const {
+        return chain;
+    }
+
+    BudgetReport analyze(const std::vector<TraceNode>& nodes) const {
+        const auto start = std::chrono::steady_clock::now();
+        BudgetReport report;
+        report.levelsTotal = chain.depth();
+        std::vector<BudgetNode> state(nodes.size() + 1);
+        std::vector<bool> used(nodes.size() + 1, false);
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            const TraceNode& n = nodes[i];
+            if (n.id != i + 1)
+                throw std::invalid_argument("BudgetAnalyzer: node ids must be 1..n in recording order");
+            for (uint64_t operand : n.operands) {
+                if (operand == 0 || operand > i)
+                    throw std::invalid_argument("BudgetAnalyzer: node " + std::to_string(i + 1) +
+                                                " has an unrecorded operand");
+                used[operand] = true;
+            }
+
+            Context ctx{n, report};
+            BudgetNode r = evaluate(n, state, ctx);
+            r.id         = n.id;
+            r.op         = n.op;
+            r.headroomBits = chain.logQ(std::min(r.level, chain.depth())) - r.logScale() - r.logMagnitude - 1;
+            if (r.headroomBits < 0)
+                ctx.issue("scale overflow: scale " + bits(r.logScale()) + " * magnitude " + bits(r.logMagnitude) +
+                          " exceeds Q at " + levelName(r.level) + " (" + bits(chain.logQ(r.level)) + ")");
+            state[n.id] = r;
+            report.levelsUsed      = std::max(report.levelsUsed, r.level + (r.noiseScaleDeg > 1 ? 1 : 0));
+            report.minHeadroomBits = std::min(report.minHeadroomBits, r.headroomBits);
+        }
+        report.nodes.assign(state.begin() + 1, state.end());
+
+        for (const auto& n : report.nodes) {
+            if (used[n.id])
+                continue;
+            report.outputs.push_back(n.id);
+            report.precisionBits = std::min(report.precisionBits, n.precisionBits());
+            if (requiredBits > 0 && n.precisionBits() < requiredBits) {
+                std::ostringstream os;
+                os << std::fixed << std::setprecision(2) << "estimated precision " << n.precisionBits()
+                   << " bits < required " << requiredBits << " bits";
+                report.issues.push_back({n.id, n.op, os.str()});
+            }
+        }
+        report.analysisUs =
+            std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+        return report;
+    }
+};
+
+// ------------------------------- CircuitBuilder
+// 암호문 없이 회로를 TraceNode로 작성 (BudgetAnalyzer 입력). 반환값은 노드 id
+class CircuitBuilder {
+private:
+    std::vector<TraceNode> nodes;
+
+    uint64_t push(const std::string& op, std::vector<uint64_t> operands, double constant = 0,
+                  std::vector<double> weights = {}) {
+        TraceNode n;
+        n.id       = nodes.size() + 1;
+        n.op       = op;
+        n.operands = std::move(operands);
+        n.constant = constant;
+        n.weights  = std::move(weights);
+        nodes.push_back(std::move(n));
+        return nodes.back().id;
+    }
+
+public:
+    uint64_t input() {
+        return push("input", {});
+    }
+    uint64_t add(uint64_t a, uint64_t b) {
+        return push("cipherAdd", {a, b});
+    }
+    uint64_t sub(uint64_t a, uint64_t b) {
+        return push("cipherSub", {a, b});
+    }
+    uint64_t negate(uint64_t a) {
+        return push("cipherNegate", {a});
+    }
+    uint64_t addConst(uint64_t a, double constant) {
+        return push("cipherAdd(const)", {a}, constant);
+    }
+    uint64_t mult(uint64_t a, uint64_t b) {
+        return push("cipherMult", {a, b});
+    }
+    uint64_t multConst(uint64_t a, double constant) {
+        return push("cipherMult(const)", {a}, constant);
+    }
+    uint64_t square(uint64_t a) {
+        return push("cipherSquare", {a});
+    }
+    uint64_t linearWSum(std::vector<uint64_t> terms, std::vector<double> weights, double constant = 0) {
+        return push("cipherLinearWSum", std::move(terms), constant, std::move(weights));
+    }
+    uint64_t rotate(uint64_t a, int32_t index) {
+        return push("cipherRotate(" + std::to_string(index) + ")", {a});
+    }
+    uint64_t rescale(uint64_t a) {
+        return push("cipherRescale", {a});
+    }
+
+    const std::vector<TraceNode>& getNodes() const {
+        return nodes;
+    }
+};
+
+}  // namespace lbcrypto
+
+#endif
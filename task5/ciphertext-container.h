@@ -0,0 +1,280 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Ciphertext container file format (backend 무관, 직렬화된 바이트만 다룸)
+    header : "CKCT" | version | backend | flags(bit0: zstd)
+    record : storedSize(u64) | rawSize(u64) | shadowCount(u64) | payload | shadow (complex<double> × shadowCount)
+    index  : record offset(u64) × count | count(u64) | indexOffset(u64) | "CKCI"
+  읽기는 mmap: 파일 끝의 index로 임의 record에 바로 접근하고, 압축하지 않은 payload는 복사 없이 포인터로 반환
+  zstd 압축은 -DWITH_ZSTD -lzstd 로 빌드했을 때만 사용 가능
+ */
+
+#ifndef LBCRYPTO_TRACE_CIPHERTEXT_CONTAINER_H
+#define LBCRYPTO_TRACE_CIPHERTEXT_CONTAINER_H
+
+#include <complex>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "mapped-file.h"
+
+#ifdef WITH_ZSTD
+    #include <zstd.h>
+#endif
+
+namespace lbcrypto {
+
+enum ContainerBackend : uint32_t { CONTAINER_SEAL = 1, CONTAINER_OPENFHE = 2 };
+
+class CiphertextContainer {
+public:
+    static constexpr uint32_t HEADER_MAGIC = 0x54434b43;   // "CKCT"
+    static constexpr uint32_t FOOTER_MAGIC = 0x49434b43;   // "CKCI"
+    static constexpr uint32_t VERSION      = 1;
+    static constexpr uint32_t FLAG_ZSTD    = 1;
+
+    static bool zstdAvailable() {
+#ifdef WITH_ZSTD
+        return true;
+#else
+        return false;
+#endif
+    }
+};
+
+// ------------------------------- ContainerWriter
+class ContainerWriter {
+private:
+    std::ofstream out;
+    std::string path;
+    uint32_t flags;
+    int compressionLevel;
+    uint64_t offset = 0;
+    std::vector<uint64_t> index;
+    std::vector<char> compressed;
+
+    template <typename T>
+    void writeRaw(const T& value) {
+        write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    void write(const char* data, size_t size) {
+        out.write(data, static_cast<std::streamsize>(size));
+        offset += size;
+    }
+
+public:
+    // compressionLevel > 0: payload를 zstd로 압축 (WITH_ZSTD 필요)
+    ContainerWriter(const std::string& path, ContainerBackend backend, int compressionLevel = 0)
+        : out(path, std::ios::binary | std::ios::trunc),
+          path(path),
+          flags(compressionLevel > 0 ? CiphertextContainer::FLAG_ZSTD : 0),
+          compressionLevel(compressionLevel) {
+        if (!out)
+            throw std::runtime_error("ContainerWriter: cannot open " + path);
+        if ((flags & CiphertextContainer::FLAG_ZSTD) && !CiphertextContainer::zstdAvailable())
+            throw std::runtime_error("ContainerWriter: built without zstd (define WITH_ZSTD)");
+        writeRaw(CiphertextContainer::HEADER_MAGIC);
+        writeRaw(CiphertextContainer::VERSION);
+        writeRaw(static_cast<uint32_t>(backend));
+        writeRaw(flags);
+    }
+
+    // 소멸자에서는 예외를 던지지 않음: 실패를 알아야 하면 close()를 직접 호출
+    ~ContainerWriter() {
+        if (!out.is_open())
+            return;
+        try {
+            close();
+        }
+        catch (const std::exception& e) {
+            std::cerr << "ContainerWriter: " << e.what() << std::endl;
+        }
+    }
+
+    ContainerWriter(const ContainerWriter&)            = delete;
+    ContainerWriter& operator=(const ContainerWriter&) = delete;
+
+    // payload: 직렬화된 암호문, shadow: 함께 저장할 평문 벡터 (TraceableCiphertext의 original vector)
+    void append(const char* payload, size_t size, const std::vector<std::complex<double>>& shadow = {}) {
+        index.push_back(offset);
+        const char* stored   = payload;
+        uint64_t storedSize  = size;
+#ifdef WITH_ZSTD
+        if (flags & CiphertextContainer::FLAG_ZSTD) {
+            compressed.resize(ZSTD_compressBound(size));
+            size_t n = ZSTD_compress(compressed.data(), compressed.size(), payload, size, compressionLevel);
+            if (ZSTD_isError(n))
+                throw std::runtime_error(std::string("ContainerWriter: ") + ZSTD_getErrorName(n));
+            stored     = compressed.data();
+            storedSize = n;
+        }
+#endif
+        writeRaw(storedSize);
+        writeRaw(static_cast<uint64_t>(size));
+        writeRaw(static_cast<uint64_t>(shadow.size()));
+        write(stored, storedSize);
+        if (!shadow.empty())
+            write(reinterpret_cast<const char*>(shadow.data()), shadow.size() * sizeof(std::complex<double>));
+    }
+
+    void append(const std::string& payload, const std::vector<std::complex<double>>& shadow = {}) {
+        append(payload.data(), payload.size(), shadow);
+    }
+
+    size_t size() const {
+        return index.size();
+    }
+
+    uint64_t bytesWritten() const {
+        return offset;
+    }
+
+    // index와 footer를 쓰고 파일을 닫음
+    void close() {
+        uint64_t indexOffset = offset;
+        for (uint64_t o : index)
+            writeRaw(o);
+        writeRaw(static_cast<uint64_t>(index.size()));
+        writeRaw(indexOffset);
+        writeRaw(CiphertextContainer::FOOTER_MAGIC);
+        out.close();
+        if (!out)
+            throw std::runtime_error("ContainerWriter: write failed " + path);
+    }
+};
+
+// ------------------------------- ContainerReader
+class ContainerReader {
+private:
+    MappedFile file;
+    const char* base;
+    size_t fileSize;
+    uint32_t backendId;
+    uint32_t flags;
+    const char* indexData = nullptr;
+    uint64_t count        = 0;
+
+    template <typename T>
+    T readAt(uint64_t pos) const {
+        if (pos + sizeof(T) > fileSize)
+            throw std::runtime_error("ContainerReader: truncated container");
+        T value;
+        std::memcpy(&value, base + pos, sizeof(T));
+        return value;
+    }
+
+    struct Record {
+        uint64_t storedSize;
+        uint64_t rawSize;
+        uint64_t shadowCount;
+        uint64_t payloadPos;
+    };
+
+    Record record(size_t i) const {
+        if (i >= count)
+            throw std::out_of_range("ContainerReader: record index out of range");
+        uint64_t pos;
+        std::memcpy(&pos, indexData + i * sizeof(uint64_t), sizeof(uint64_t));
+        Record r{readAt<uint64_t>(pos), readAt<uint64_t>(pos + 8), readAt<uint64_t>(pos + 16), pos + 24};
+        if (r.payloadPos + r.storedSize + r.shadowCount * sizeof(std::complex<double>) > fileSize)
+            throw std::runtime_error("ContainerReader: truncated container");
+        return r;
+    }
+
+public:
+    explicit ContainerReader(const std::string& path) : file(path), base(file.data()), fileSize(file.size()) {
+        if (fileSize < 16 + 20 || readAt<uint32_t>(0) != CiphertextContainer::HEADER_MAGIC ||
+            readAt<uint32_t>(4) != CiphertextContainer::VERSION ||
+            readAt<uint32_t>(fileSize - 4) != CiphertextContainer::FOOTER_MAGIC)
+            throw std::runtime_error("ContainerReader: not a ciphertext container " + path);
+        backendId            = readAt<uint32_t>(8);
+        flags                = readAt<uint32_t>(12);
+        count                = readAt<uint64_t>(fileSize - 20);
+        uint64_t indexOffset = readAt<uint64_t>(fileSize - 12);
+        if (indexOffset + count * sizeof(uint64_t) != fileSize - 20)
+            throw std::runtime_error("ContainerReader: corrupt index " + path);
+        indexData = base + indexOffset;
+    }
+
+    size_t size() const {
+        return count;
+    }
+
+    uint32_t backend() const {
+        return backendId;
+    }
+
+    bool compressed() const {
+        return flags & CiphertextContainer::FLAG_ZSTD;
+    }
+
+    size_t getFileSize() const {
+        return fileSize;
+    }
+
+    // i번째 payload. 압축하지 않은 컨테이너는 mmap 영역을 그대로 가리킴(복사 없음),
+    // 압축된 컨테이너는 scratch에 풀어서 반환
+    std::pair<const char*, size_t> payload(size_t i, std::vector<char>& scratch) const {
+        Record r = record(i);
+        if (!compressed())
+            return {base + r.payloadPos, r.storedSize};
+#ifdef WITH_ZSTD
+        scratch.resize(r.rawSize);
+        size_t n = ZSTD_decompress(scratch.data(), scratch.size(), base + r.payloadPos, r.storedSize);
+        if (ZSTD_isError(n) || n != r.rawSize)
+            throw std::runtime_error("ContainerReader: zstd decompression failed");
+        return {scratch.data(), r.rawSize};
+#else
+        (void)scratch;
+        throw std::runtime_error("ContainerReader: built without zstd (define WITH_ZSTD)");
+#endif
+    }
+
+    std::vector<std::complex<double>> shadow(size_t i) const {
+        Record r = record(i);
+        std::vector<std::complex<double>> values(r.shadowCount);
+        if (r.shadowCount)
+            std::memcpy(values.data(), base + r.payloadPos + r.storedSize, r.shadowCount * sizeof(std::complex<double>));
+        return values;
+    }
+};
+
+}  // namespace lbcrypto
+
+#endif
@@ -0,0 +1,197 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Common-subexpression memo for TracedCiphertext (TraceableCiphertext 포함)
+  (연산, 피연산자 암호문, 상수)를 key로 결과 암호문과 original vector를 보관. 같은 연산을 다시 요청하면 계산하지 않고 재사용
+  - 덧셈, 곱셈은 피연산자 순서를 정렬해서 x*y와 y*x가 같은 key
+  - x + x는 ADD(x, x) key. x * 2는 x + x의 결과가 있으면 그것을 재사용 (반대는 안 함: x * 2는 레벨을 씀)
+  - 항목은 피연산자 암호문도 붙잡고 있으므로 memo가 살아 있는 동안 key의 주소가 다른 암호문에 재사용되지 않음
+  - 여러 스레드에서 공유 가능
+ */
+
+#ifndef LBCRYPTO_TRACE_CIRCUIT_MEMO_H
+#define LBCRYPTO_TRACE_CIRCUIT_MEMO_H
+
+#include <complex>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace lbcrypto {
+
+enum class MemoOp : uint8_t {
+    ADD,
+    ADD_CONST,
+    SUB,            // 피연산자 순서 유지
+    NEGATE,
+    MULT,
+    MULT_CONST,     // x * c
+    SQUARE,
+    ROTATE          // constant = 회전 index
+};
+
+struct MemoKey {
+    MemoOp op;
+    const void* lhs;
+    const void* rhs;
+    double constant;
+
+    // ADD, MULT는 피연산자 순서와 무관
+    MemoKey(MemoOp op, const void* lhs, const void* rhs = nullptr, double constant = 0)
+        : op(op), lhs(lhs), rhs(rhs), constant(constant) {
+        if ((op == MemoOp::ADD || op == MemoOp::MULT) && std::less<const void*>()(rhs, lhs))
+            std::swap(this->lhs, this->rhs);
+    }
+
+    // 서로 관계없는 포인터의 <는 unspecified이므로 정수 주소로 비교
+    bool operator<(const MemoKey& other) const {
+        return std::make_tuple(op, address(lhs), address(rhs), constant) <
+               std::make_tuple(other.op, address(other.lhs), address(other.rhs), other.constant);
+    }
+
+private:
+    static uintptr_t address(const void* p) {
+        return reinterpret_cast<uintptr_t>(p);
+    }
+};
+
+struct MemoStats {
+    uint64_t lookups         = 0;
+    uint64_t hits            = 0;
+    uint64_t savedMults      = 0;   // 암호문*암호문 (square 포함): relinearization 포함
+    uint64_t savedConstMults = 0;
+    uint64_t savedAdds       = 0;   // 뺄셈, negate 포함
+    uint64_t savedRotations  = 0;   // key switching
+    uint64_t squares         = 0;   // x * x를 EvalSquare로 계산한 횟수
+    uint64_t doublings       = 0;   // x * 2를 x + x의 결과로 대신한 횟수
+
+    double hitRate() const {
+        return lookups ? static_cast<double>(hits) / lookups : 0;
+    }
+};
+
+inline void printMemoStats(const MemoStats& stats, std::ostream& os = std::cout) {
+    os << "Memo: " << stats.hits << "/" << stats.lookups << " hits, saved " << stats.savedMults << " mult, "
+       << stats.savedConstMults << " const mult, " << stats.savedAdds << " add, " << stats.savedRotations
+       << " rotation; " << stats.squares << " squares, " << stats.doublings << " x*2 -> x+x" << std::endl;
+}
+
+// ------------------------------- CircuitMemo
+// CiphertextHandle: backend의 암호문 handle (OpenFHE Ciphertext<DCRTPoly>, SEALTraceBackend::Ciphertext). get()이 key의 주소
+template <typename CiphertextHandle>
+class CircuitMemo {
+public:
+    struct Entry {
+        CiphertextHandle ciphertext;
+        std::vector<std::complex<double>> originalVector;
+        uint64_t nodeId = 0;
+        CiphertextHandle lhs, rhs;  // key의 주소를 유지
+    };
+
+private:
+    std::map<MemoKey, std::shared_ptr<const Entry>> entries;
+    MemoStats stats;
+    mutable std::mutex mtx;
+
+public:
+    std::shared_ptr<const Entry> find(const MemoKey& key) {
+        return find(key, key.op);
+    }
+
+    // saved: hit일 때 절약한 연산으로 집계할 종류 (x * 2를 x + x 결과로 대신하면 MULT_CONST)
+    std::shared_ptr<const Entry> find(const MemoKey& key, MemoOp saved) {
+        std::lock_guard<std::mutex> lock(mtx);
+        ++stats.lookups;
+        auto it = entries.find(key);
+        if (it == entries.end())
+            return nullptr;
+        ++stats.hits;
+        if (saved != key.op)
+            ++stats.doublings;
+        switch (saved) {
+            case MemoOp::ADD:
+            case MemoOp::ADD_CONST:
+            case MemoOp::SUB:
+            case MemoOp::NEGATE:
+                ++stats.savedAdds;
+                break;
+            case MemoOp::MULT:
+            case MemoOp::SQUARE:
+                ++stats.savedMults;
+                break;
+            case MemoOp::MULT_CONST:
+                ++stats.savedConstMults;
+                break;
+            case MemoOp::ROTATE:
+                ++stats.savedRotations;
+                break;
+        }
+        return it->second;
+    }
+
+    // 다른 스레드가 먼저 넣었으면 그 항목을 유지
+    void insert(const MemoKey& key, Entry entry) {
+        std::lock_guard<std::mutex> lock(mtx);
+        entries.emplace(key, std::make_shared<const Entry>(std::move(entry)));
+    }
+
+    void noteSquare() {
+        std::lock_guard<std::mutex> lock(mtx);
+        ++stats.squares;
+    }
+
+    MemoStats getStats() const {
+        std::lock_guard<std::mutex> lock(mtx);
+        return stats;
+    }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(mtx);
+        return entries.size();
+    }
+
+    // 보관한 암호문을 모두 놓음. 통계는 유지
+    void clear() {
+        std::lock_guard<std::mutex> lock(mtx);
+        entries.clear();
+    }
+};
+
+}  // namespace lbcrypto
+
+#endif
@@ -0,0 +1,147 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Rotation(automorphism) key store: 키는 디스크에 두고 EvalRotate에 필요한 키만 불러옴
+  - automorphism index마다 파일 하나 (automorphism-<index>.bin). mmap해서 복사 없이 역직렬화
+  - 메모리 상한을 넘으면 LRU로 내보냄 (lru-key-cache.h)
+  - CryptoContext의 전역 key map은 건드리지 않음: 불러온 키 하나로 map을 만들어 scheme의 EvalAtIndex를 직접 호출
+    → 여러 스레드에서 rotate() 가능, 사용 중인 키는 내보내져도 연산이 끝날 때까지 유지
+  - relinearization key(EvalMult key)는 한 개뿐이라 대상이 아님
+ */
+
+#ifndef LBCRYPTO_TRACE_EVAL_KEY_STORE_H
+#define LBCRYPTO_TRACE_EVAL_KEY_STORE_H
+
+#include "openfhe.h"
+#include "key/key-ser.h"
+#include "scheme/ckksrns/ckksrns-ser.h"
+#include "lru-key-cache.h"
+#include "mapped-file.h"
+
+#include <fstream>
+#include <sys/stat.h>
+
+namespace lbcrypto {
+
+template <typename Element>
+class EvalKeyStore {
+private:
+    CryptoContext<Element> cc;
+    std::string dir;
+    LruKeyCache<uint32_t, EvalKeyImpl<Element>> cache;
+
+    static std::string file(const std::string& dir, uint32_t autIndex) {
+        return dir + "/automorphism-" + std::to_string(autIndex) + ".bin";
+    }
+
+    std::shared_ptr<EvalKeyImpl<Element>> load(uint32_t autIndex, size_t& bytes) const {
+        MappedFile mapped(file(dir, autIndex));
+        MemoryStreamBuffer buffer(mapped.data(), mapped.size());
+        std::istream is(&buffer);
+        EvalKey<Element> key;
+        Serial::Deserialize(key, is, SerType::BINARY);
+        bytes = mapped.size();
+        return key;
+    }
+
+public:
+    // capacityBytes: 메모리에 둘 rotation key 크기 상한 (직렬화 크기 기준)
+    EvalKeyStore(CryptoContext<Element> cc, std::string dir, size_t capacityBytes)
+        : cc(std::move(cc)),
+          dir(std::move(dir)),
+          cache(capacityBytes, [this](const uint32_t& autIndex, size_t& bytes) { return load(autIndex, bytes); }) {}
+
+    EvalKeyStore(const EvalKeyStore&)            = delete;
+    EvalKeyStore& operator=(const EvalKeyStore&) = delete;
+
+    // cc에 생성된 keyTag의 rotation key를 파일로 옮기고 전역 key map에서 제거
+    static void spill(const CryptoContext<Element>& cc, const std::string& keyTag, const std::string& dir) {
+        ::mkdir(dir.c_str(), 0755);
+        for (const auto& entry : cc->GetEvalAutomorphismKeyMap(keyTag)) {
+            std::ofstream out(file(dir, entry.first), std::ios::binary);
+            if (!out)
+                throw std::runtime_error("EvalKeyStore: cannot write " + file(dir, entry.first));
+            Serial::Serialize(entry.second, out, SerType::BINARY);
+        }
+        CryptoContextImpl<Element>::ClearEvalAutomorphismKeys(keyTag);
+    }
+
+    // index마다 생성 → 파일로 저장 → 해제. 전체 key 집합이 메모리에 동시에 올라오지 않음
+    static void generate(const CryptoContext<Element>& cc, const PrivateKey<Element>& secretKey,
+                         const std::vector<int32_t>& indices, const std::string& dir) {
+        for (int32_t index : indices) {
+            cc->EvalRotateKeyGen(secretKey, {index});
+            spill(cc, secretKey->GetKeyTag(), dir);
+        }
+    }
+
+    bool has(int32_t index) const {
+        std::ifstream in(file(dir, cc->FindAutomorphismIndex(index)));
+        return static_cast<bool>(in);
+    }
+
+    // 곧 사용할 rotation index의 키를 미리 불러옴
+    void prefetch(const std::vector<int32_t>& indices) {
+        for (int32_t index : indices)
+            cache.get(cc->FindAutomorphismIndex(index));
+    }
+
+    Ciphertext<Element> rotate(ConstCiphertext<Element> ciphertext, int32_t index) {
+        uint32_t autIndex = cc->FindAutomorphismIndex(index);
+        std::map<uint32_t, EvalKey<Element>> keyMap{{autIndex, cache.get(autIndex)}};
+        return cc->GetScheme()->EvalAtIndex(ciphertext, index, keyMap);
+    }
+
+    const std::string& getDir() const {
+        return dir;
+    }
+
+    size_t getResidentCount() const {
+        return cache.size();
+    }
+
+    void setCapacity(size_t capacityBytes) {
+        cache.setCapacity(capacityBytes);
+    }
+
+    KeyCacheStats getStats() const {
+        return cache.getStats();
+    }
+
+    void resetStats() {
+        cache.resetStats();
+    }
+};
+
+}  // namespace lbcrypto
+
+#endif
@@ -0,0 +1,198 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  CryptoContext + key snapshot
+  처음 실행할 때 CryptoContext, public/secret key, EvalMult key, rotation(automorphism) key를 디렉터리에 저장하고
+  다음 실행부터는 KeyGen 대신 불러옴. 불러올 때는 mmap한 파일을 복사 없이 역직렬화
+  tag(파라미터, rotation index 등)가 저장된 것과 다르면 불러오지 않음 → 호출 측에서 다시 생성 후 save()
+ */
+
+#ifndef LBCRYPTO_TRACE_KEY_SNAPSHOT_H
+#define LBCRYPTO_TRACE_KEY_SNAPSHOT_H
+
+#include "openfhe.h"
+#include "ciphertext-ser.h"
+#include "cryptocontext-ser.h"
+#include "key/key-ser.h"
+#include "scheme/ckksrns/ckksrns-ser.h"
+#include "mapped-file.h"
+
+#include <cerrno>
+#include <cstdio>
+#include <fcntl.h>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace lbcrypto {
+
+template <typename Element>
+class KeySnapshot {
+private:
+    std::string dir;
+    std::string tag;
+
+    std::string file(const std::string& name) const {
+        return dir + "/" + name;
+    }
+
+    // secret key가 들어 있으므로 소유자만 읽을 수 있게 0600으로 만든 뒤 연다 (이미 있던 파일도 0600으로)
+    std::ofstream openPrivate(const std::string& name) const {
+        const std::string path = file(name);
+        int fd = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0600);
+        if (fd < 0 || ::fchmod(fd, 0600) != 0) {
+            if (fd >= 0)
+                ::close(fd);
+            throw std::runtime_error("KeySnapshot: cannot write " + path);
+        }
+        ::close(fd);
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        if (!out)
+            throw std::runtime_error("KeySnapshot: cannot write " + path);
+        return out;
+    }
+
+    static void finish(std::ofstream& out, const std::string& path) {
+        out.close();
+        if (!out)
+            throw std::runtime_error("KeySnapshot: write failed " + path);
+    }
+
+    template <typename T>
+    void saveObject(const std::string& name, const T& obj) const {
+        std::ofstream out = openPrivate(name);
+        Serial::Serialize(obj, out, SerType::BINARY);
+        finish(out, file(name));
+    }
+
+    template <typename T>
+    void loadObject(const std::string& name, T& obj) const {
+        MappedFile mapped(file(name));
+        MemoryStreamBuffer buffer(mapped.data(), mapped.size());
+        std::istream is(&buffer);
+        Serial::Deserialize(obj, is, SerType::BINARY);
+    }
+
+public:
+    // tag: 스냅샷을 만든 설정. 예) "depth5-scale50-FLEXIBLEAUTO-rot2"
+    KeySnapshot(std::string dir, std::string tag) : dir(std::move(dir)), tag(std::move(tag)) {}
+
+    const std::string& getDir() const {
+        return dir;
+    }
+
+    bool exists() const {
+        std::ifstream in(file("manifest.txt"));
+        std::string saved;
+        return in && std::getline(in, saved) && saved == tag;
+    }
+
+    // cc에 생성된 EvalMult key와 rotation key도 함께 저장
+    void save(const CryptoContext<Element>& cc, const KeyPair<Element>& keys) const {
+        if (::mkdir(dir.c_str(), 0700) != 0 && errno != EEXIST)
+            throw std::runtime_error("KeySnapshot: cannot create " + dir);
+        if (::chmod(dir.c_str(), 0700) != 0)
+            throw std::runtime_error("KeySnapshot: cannot chmod " + dir);
+        // manifest를 먼저 지움: 키를 쓰는 도중에 실패하면 다음 실행에서 exists()가 false
+        if (std::remove(file("manifest.txt").c_str()) != 0 && errno != ENOENT)
+            throw std::runtime_error("KeySnapshot: cannot remove " + file("manifest.txt"));
+        saveObject("cryptocontext.bin", cc);
+        saveObject("public-key.bin", keys.publicKey);
+        saveObject("secret-key.bin", keys.secretKey);
+        {
+            std::ofstream out = openPrivate("eval-mult-key.bin");
+            cc->SerializeEvalMultKey(out, SerType::BINARY);
+            finish(out, file("eval-mult-key.bin"));
+        }
+        {
+            std::ofstream out = openPrivate("eval-automorphism-key.bin");
+            cc->SerializeEvalAutomorphismKey(out, SerType::BINARY);
+            finish(out, file("eval-automorphism-key.bin"));
+        }
+        // manifest는 모든 키를 쓴 뒤 마지막에
+        std::ofstream manifest = openPrivate("manifest.txt");
+        manifest << tag << "\n";
+        finish(manifest, file("manifest.txt"));
+    }
+
+    // 스냅샷이 없거나 tag가 다르거나 역직렬화에 실패하면(손상된 파일, 다른 OpenFHE 빌드에서 저장) false
+    // 실패하면 일부만 불러온 전역 키 상태를 지우므로 호출한 쪽은 KeyGen으로 새로 만들면 됨
+    bool load(CryptoContext<Element>& cc, KeyPair<Element>& keys) const {
+        if (!exists())
+            return false;
+        clearGlobalKeys();
+        try {
+            loadAll(cc, keys);
+        }
+        catch (const std::exception& e) {
+            std::cerr << "KeySnapshot: cannot load " << dir << " (" << e.what() << "), regenerating keys" << std::endl;
+            clearGlobalKeys();
+            cc   = nullptr;
+            keys = KeyPair<Element>();
+            return false;
+        }
+        return true;
+    }
+
+private:
+    static void clearGlobalKeys() {
+        CryptoContextImpl<Element>::ClearEvalMultKeys();
+        CryptoContextImpl<Element>::ClearEvalAutomorphismKeys();
+        CryptoContextFactory<Element>::ReleaseAllContexts();
+    }
+
+    void loadAll(CryptoContext<Element>& cc, KeyPair<Element>& keys) const {
+        loadObject("cryptocontext.bin", cc);
+        loadObject("public-key.bin", keys.publicKey);
+        loadObject("secret-key.bin", keys.secretKey);
+        {
+            MappedFile mapped(file("eval-mult-key.bin"));
+            MemoryStreamBuffer buffer(mapped.data(), mapped.size());
+            std::istream is(&buffer);
+            if (!cc->DeserializeEvalMultKey(is, SerType::BINARY))
+                throw std::runtime_error("cannot load eval mult key");
+        }
+        {
+            MappedFile mapped(file("eval-automorphism-key.bin"));
+            MemoryStreamBuffer buffer(mapped.data(), mapped.size());
+            std::istream is(&buffer);
+            if (!cc->DeserializeEvalAutomorphismKey(is, SerType::BINARY))
+                throw std::runtime_error("cannot load rotation keys");
+        }
+    }
+};
+
+}  // namespace lbcrypto
+
+#endif
@@ -0,0 +1,202 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  메모리 상한이 있는 LRU 키 캐시 (evaluation key store 공용)
+  - get(key): 메모리에 있으면 hit, 없으면 loader로 불러오고(miss) 상한을 넘으면 가장 오래 안 쓴 키부터 내보냄
+  - 반환된 shared_ptr을 들고 있는 동안은 내보내져도 메모리가 해제되지 않음 (상한은 캐시가 쥔 키 기준)
+  - hit/miss/eviction 수와 load 지연 시간(합계, 최대)을 기록
+ */
+
+#ifndef LBCRYPTO_TRACE_LRU_KEY_CACHE_H
+#define LBCRYPTO_TRACE_LRU_KEY_CACHE_H
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace lbcrypto {
+
+// ------------------------------- KeyCacheStats
+struct KeyCacheStats {
+    size_t hits              = 0;
+    size_t misses            = 0;
+    size_t evictions         = 0;
+    double loadMs            = 0;  // miss에서 불러오는 데 걸린 시간 합계
+    double maxLoadMs         = 0;
+    size_t residentBytes     = 0;
+    size_t peakResidentBytes = 0;
+
+    double hitRate() const {
+        size_t total = hits + misses;
+        return total ? static_cast<double>(hits) / total : 0;
+    }
+
+    double meanLoadMs() const {
+        return misses ? loadMs / misses : 0;
+    }
+};
+
+inline void printKeyCacheStats(const std::string& name, const KeyCacheStats& s, std::ostream& os = std::cout) {
+    std::ios::fmtflags flags = os.flags();
+    os << std::fixed << std::setprecision(2);
+    os << name << ": hits " << s.hits << ", misses " << s.misses << " (hit rate " << 100 * s.hitRate()
+       << "%), evictions " << s.evictions << ", load " << s.meanLoadMs() << " ms avg / " << s.maxLoadMs
+       << " ms max, resident " << s.residentBytes / (1024.0 * 1024.0) << " MB (peak "
+       << s.peakResidentBytes / (1024.0 * 1024.0) << " MB)" << std::endl;
+    os.flags(flags);
+}
+
+// ------------------------------- LruKeyCache
+template <typename Key, typename Value>
+class LruKeyCache {
+public:
+    // key를 불러와서 반환하고 bytes에 메모리 크기를 채움
+    using Loader = std::function<std::shared_ptr<Value>(const Key& key, size_t& bytes)>;
+    // 캐시에서 내보낼 때 호출 (예: CryptoContext의 key map에서 제거)
+    using Evictor = std::function<void(const Key& key)>;
+
+private:
+    struct Entry {
+        std::shared_ptr<Value> value;
+        size_t bytes;
+        typename std::list<Key>::iterator position;
+    };
+
+    size_t capacityBytes;
+    Loader loader;
+    Evictor evictor;
+    std::list<Key> order;  // 앞쪽이 최근에 사용한 키
+    std::map<Key, Entry> entries;
+    KeyCacheStats stats;
+    mutable std::mutex mtx;
+
+    // keep은 방금 불러온 키: 상한보다 커도 내보내지 않음
+    void evictLocked(const Key& keep) {
+        while (stats.residentBytes > capacityBytes && !order.empty() && order.back() != keep) {
+            auto it = entries.find(order.back());
+            stats.residentBytes -= it->second.bytes;
+            stats.evictions++;
+            if (evictor)
+                evictor(it->first);
+            order.pop_back();
+            entries.erase(it);
+        }
+    }
+
+public:
+    LruKeyCache(size_t capacityBytes, Loader loader, Evictor evictor = nullptr)
+        : capacityBytes(capacityBytes), loader(std::move(loader)), evictor(std::move(evictor)) {}
+
+    // 불러오기는 lock 안에서: 같은 키를 두 번 불러오지 않음
+    std::shared_ptr<Value> get(const Key& key) {
+        std::lock_guard<std::mutex> lock(mtx);
+        auto it = entries.find(key);
+        if (it != entries.end()) {
+            stats.hits++;
+            order.splice(order.begin(), order, it->second.position);
+            return it->second.value;
+        }
+
+        using Clock                  = std::chrono::steady_clock;
+        Clock::time_point start      = Clock::now();
+        size_t bytes                 = 0;
+        std::shared_ptr<Value> value = loader(key, bytes);
+        double ms                    = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+        stats.misses++;
+        stats.loadMs += ms;
+        stats.maxLoadMs = std::max(stats.maxLoadMs, ms);
+
+        order.push_front(key);
+        entries.emplace(key, Entry{value, bytes, order.begin()});
+        stats.residentBytes += bytes;
+        stats.peakResidentBytes = std::max(stats.peakResidentBytes, stats.residentBytes);
+        evictLocked(key);
+        return value;
+    }
+
+    bool contains(const Key& key) const {
+        std::lock_guard<std::mutex> lock(mtx);
+        return entries.count(key) != 0;
+    }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(mtx);
+        return entries.size();
+    }
+
+    size_t getCapacity() const {
+        std::lock_guard<std::mutex> lock(mtx);
+        return capacityBytes;
+    }
+
+    void setCapacity(size_t bytes) {
+        std::lock_guard<std::mutex> lock(mtx);
+        capacityBytes = bytes;
+        if (!order.empty())
+            evictLocked(order.front());
+    }
+
+    KeyCacheStats getStats() const {
+        std::lock_guard<std::mutex> lock(mtx);
+        return stats;
+    }
+
+    // 통계만 초기화 (메모리에 있는 키는 유지)
+    void resetStats() {
+        std::lock_guard<std::mutex> lock(mtx);
+        size_t resident     = stats.residentBytes;
+        stats               = KeyCacheStats();
+        stats.residentBytes = stats.peakResidentBytes = resident;
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> lock(mtx);
+        for (auto& entry : entries) {
+            if (evictor)
+                evictor(entry.first);
+        }
+        entries.clear();
+        order.clear();
+        stats.residentBytes = 0;
+    }
+};
+
+}  // namespace lbcrypto
+
+#endif
@@ -0,0 +1,103 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  같은 회로를 여러 암호문에 병렬로 적용하는 batch executor (OpenFHE)
+  OpenFHE는 연산 내부(NTT, limb 단위)에서 OpenMP를 쓰므로 WorkStealingPool worker 수 × OpenMP 스레드 수가
+  코어 수를 넘지 않도록 worker마다 omp_set_num_threads(cores / workers)를 설정
+ */
+
+#ifndef LBCRYPTO_TRACE_OPENFHE_BATCH_EXECUTOR_H
+#define LBCRYPTO_TRACE_OPENFHE_BATCH_EXECUTOR_H
+
+#include "openfhe.h"
+#include "work-stealing-pool.h"
+
+#include <functional>
+#include <vector>
+
+#ifdef _OPENMP
+    #include <omp.h>
+#endif
+
+namespace lbcrypto {
+
+template <typename Element>
+class BatchExecutor {
+public:
+    using Circuit = std::function<Ciphertext<Element>(const Ciphertext<Element>&)>;
+
+private:
+    WorkStealingPool pool;
+    uint32_t ompThreadsPerWorker;
+
+public:
+    // ompThreadsPerWorker = 0: 전체 코어 수를 worker 수로 나눈 값 (최소 1)
+    explicit BatchExecutor(size_t numWorkers = std::thread::hardware_concurrency(), uint32_t ompThreadsPerWorker = 0)
+        : pool(numWorkers), ompThreadsPerWorker(ompThreadsPerWorker) {
+        if (this->ompThreadsPerWorker == 0) {
+            size_t cores              = std::max<size_t>(std::thread::hardware_concurrency(), 1);
+            this->ompThreadsPerWorker = static_cast<uint32_t>(std::max<size_t>(cores / pool.size(), 1));
+        }
+    }
+
+    size_t getNumWorkers() const {
+        return pool.size();
+    }
+
+    uint32_t getOmpThreadsPerWorker() const {
+        return ompThreadsPerWorker;
+    }
+
+    size_t getStealCount() const {
+        return pool.getStealCount();
+    }
+
+    // grain: 한 번에 가져가는 암호문 수. 0이면 worker당 chunk 4개 정도가 되도록 정함
+    std::vector<Ciphertext<Element>> run(const std::vector<Ciphertext<Element>>& inputs, const Circuit& circuit,
+                                         size_t grain = 0) {
+        std::vector<Ciphertext<Element>> outputs(inputs.size());
+        if (grain == 0)
+            grain = std::max<size_t>(1, inputs.size() / (4 * pool.size()));
+        pool.parallelFor(inputs.size(), grain, [&](size_t begin, size_t end, size_t) {
+#ifdef _OPENMP
+            omp_set_num_threads(static_cast<int>(ompThreadsPerWorker));   // 이 스레드의 parallel region에만 적용
+#endif
+            for (size_t i = begin; i < end; ++i)
+                outputs[i] = circuit(inputs[i]);
+        });
+        return outputs;
+    }
+};
+
+}  // namespace lbcrypto
+
+#endif
@@ -0,0 +1,89 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  OpenFHE Ciphertext <-> CiphertextContainer
+  TraceableCiphertext는 암호문과 original vector(shadow)를 같은 record에 저장
+  OpenFHE는 seed로 압축한 fresh 암호문 직렬화를 지원하지 않으므로 크기 절감은 zstd로만 가능
+ */
+
+#ifndef LBCRYPTO_TRACE_OPENFHE_CONTAINER_H
+#define LBCRYPTO_TRACE_OPENFHE_CONTAINER_H
+
+#include "openfhe.h"
+#include "ciphertext-ser.h"
+#include "cryptocontext-ser.h"
+#include "scheme/ckksrns/ckksrns-ser.h"
+#include "ciphertext-container.h"
+#include "traceable-ciphertext.h"
+
+#include <sstream>
+
+namespace lbcrypto {
+
+template <typename Element>
+void appendCiphertext(ContainerWriter& writer, const Ciphertext<Element>& ct,
+                      const std::vector<std::complex<double>>& shadow = {}) {
+    std::ostringstream os;
+    Serial::Serialize(ct, os, SerType::BINARY);
+    writer.append(os.str(), shadow);
+}
+
+template <typename Element>
+void appendTraceable(ContainerWriter& writer, const TraceableCiphertext<Element>& tc) {
+    appendCiphertext(writer, tc.getCiphertext(), tc.getOriginalVector());
+}
+
+// 암호문을 불러오려면 같은 CryptoContext가 먼저 만들어져 있어야 함
+template <typename Element>
+Ciphertext<Element> loadCiphertext(const ContainerReader& reader, size_t i, std::vector<char>& scratch) {
+    if (reader.backend() != CONTAINER_OPENFHE)
+        throw std::runtime_error("loadCiphertext: not an OpenFHE container");
+    auto data = reader.payload(i, scratch);
+    MemoryStreamBuffer buffer(data.first, data.second);
+    std::istream is(&buffer);
+    Ciphertext<Element> ct;
+    Serial::Deserialize(ct, is, SerType::BINARY);
+    return ct;
+}
+
+template <typename Element>
+TraceableCiphertext<Element> loadTraceable(const ContainerReader& reader, size_t i,
+                                           const std::shared_ptr<OpenFHETraceBackend<Element>>& backend,
+                                           const TracePolicy& policy = TracePolicy()) {
+    std::vector<char> scratch;
+    Ciphertext<Element> ct = loadCiphertext<Element>(reader, i, scratch);
+    return TraceableCiphertext<Element>(backend, reader.shadow(i), ct, policy);
+}
+
+}  // namespace lbcrypto
+
+#endif
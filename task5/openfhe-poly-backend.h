@@ -0,0 +1,82 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  OpenFHE backend for PolyEvaluator
+  Rescaling and level alignment are left to the CryptoContext's ScalingTechnique (FLEXIBLEAUTO / FIXEDAUTO)
+ */
+
+#ifndef LBCRYPTO_TRACE_OPENFHE_POLY_BACKEND_H
+#define LBCRYPTO_TRACE_OPENFHE_POLY_BACKEND_H
+
+#include "poly-evaluator.h"
+
+namespace lbcrypto {
+
+template <typename Element>
+class OpenFHEPolyBackend {
+public:
+    using Ciphertext = lbcrypto::Ciphertext<Element>;
+
+private:
+    CryptoContext<Element> cryptoContext;
+
+public:
+    explicit OpenFHEPolyBackend(const CryptoContext<Element>& cc) : cryptoContext(cc) {}
+
+    Ciphertext mult(const Ciphertext& a, const Ciphertext& b) {
+        return cryptoContext->EvalMult(a, b);
+    }
+
+    Ciphertext square(const Ciphertext& a) {
+        return cryptoContext->EvalSquare(a);
+    }
+
+    Ciphertext multConst(const Ciphertext& a, double constant) {
+        return cryptoContext->EvalMult(a, constant);
+    }
+
+    Ciphertext add(const Ciphertext& a, const Ciphertext& b) {
+        return cryptoContext->EvalAdd(a, b);
+    }
+
+    Ciphertext addConst(const Ciphertext& a, double constant) {
+        return cryptoContext->EvalAdd(a, constant);
+    }
+
+    Ciphertext negate(const Ciphertext& a) {
+        return cryptoContext->EvalNegate(a);
+    }
+};
+
+}  // namespace lbcrypto
+
+#endif
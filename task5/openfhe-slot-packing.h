@@ -0,0 +1,132 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Multi-tenant slot packing for OpenFHE CKKS (slot-packer.h의 layout 사용)
+  작은 벡터 여러 개를 암호문 하나의 서로 다른 block에 넣고 회로를 한 번만 평가
+  - 원소별 연산은 packed 암호문에 그대로 EvalAdd/EvalMult
+  - rotateWithinBlocks(ct, k): 각 block 안에서의 순환 회전. 회전 2번 + mask 곱 2번 (레벨 1 소모)
+    blockSize를 tenant 길이와 같게 두면 SetBatchSize(blockSize)인 암호문의 EvalRotate와 결과가 같음
+  - 필요한 rotation key는 rotationIndices()로 구해서 EvalRotateKeyGen
+ */
+
+#ifndef LBCRYPTO_TRACE_OPENFHE_SLOT_PACKING_H
+#define LBCRYPTO_TRACE_OPENFHE_SLOT_PACKING_H
+
+#include "openfhe.h"
+#include "slot-packer.h"
+
+#include <map>
+#include <mutex>
+#include <set>
+
+namespace lbcrypto {
+
+template <typename Element>
+class PackedEvaluator {
+private:
+    CryptoContext<Element> cc;
+    SlotPacker packer;
+    // block 안 회전 step마다 {앞부분 mask, 뒷부분 mask}. 레벨 0으로 인코딩 (곱할 때 암호문 레벨에 맞춰 limb를 버림)
+    std::map<size_t, std::pair<Plaintext, Plaintext>> masks;
+    std::mutex mtx;
+
+    const std::pair<Plaintext, Plaintext>& getMasks(size_t step) {
+        std::lock_guard<std::mutex> lock(mtx);
+        auto it = masks.find(step);
+        if (it == masks.end()) {
+            const size_t block = packer.getBlockSize();
+            Plaintext low      = cc->MakeCKKSPackedPlaintext(packer.blockMask(0, block - step));
+            Plaintext high     = cc->MakeCKKSPackedPlaintext(packer.blockMask(block - step, block));
+            it                 = masks.emplace(step, std::make_pair(low, high)).first;
+        }
+        return it->second;
+    }
+
+public:
+    // packer.getSlots()는 CryptoContext의 batch size와 같아야 함
+    PackedEvaluator(CryptoContext<Element> cc, const SlotPacker& packer) : cc(std::move(cc)), packer(packer) {}
+
+    PackedEvaluator(const PackedEvaluator&)            = delete;
+    PackedEvaluator& operator=(const PackedEvaluator&) = delete;
+
+    const SlotPacker& getPacker() const {
+        return packer;
+    }
+
+    // 회로가 사용하는 block 안 회전 step들에 필요한 rotation index (EvalRotateKeyGen에 전달)
+    std::vector<int32_t> rotationIndices(const std::vector<int32_t>& steps) const {
+        std::set<int32_t> indices;
+        for (int32_t k : steps) {
+            for (int32_t index : packer.rotationIndices(k))
+                indices.insert(index);
+        }
+        return std::vector<int32_t>(indices.begin(), indices.end());
+    }
+
+    Ciphertext<Element> encrypt(const PublicKey<Element>& publicKey, const std::vector<std::vector<double>>& tenants) const {
+        return cc->Encrypt(publicKey, cc->MakeCKKSPackedPlaintext(packer.pack(tenants)));
+    }
+
+    // lengths[t]: tenant t의 길이
+    std::vector<std::vector<double>> decrypt(const PrivateKey<Element>& secretKey, ConstCiphertext<Element> ciphertext,
+                                             const std::vector<size_t>& lengths) const {
+        Plaintext result;
+        cc->Decrypt(secretKey, ciphertext, &result);
+        result->SetLength(packer.getSlots());
+        return packer.unpack(result->GetRealPackedValue(), lengths);
+    }
+
+    // 각 block 안에서 왼쪽으로 k만큼 순환 회전 (k < 0이면 오른쪽)
+    // block 위치 j < B - k는 전체 회전 k, j >= B - k는 전체 회전 k - B에서 가져옴
+    Ciphertext<Element> rotateWithinBlocks(ConstCiphertext<Element> ciphertext, int32_t k) {
+        const size_t step = packer.normalizeStep(k);
+        if (step == 0)
+            return ciphertext->Clone();
+        if (packer.getBlockSize() == packer.getSlots())
+            return cc->EvalRotate(ciphertext, static_cast<int32_t>(step));
+
+        const auto& mask          = getMasks(step);
+        const int32_t block       = static_cast<int32_t>(packer.getBlockSize());
+        Ciphertext<Element> front = cc->EvalRotate(ciphertext, static_cast<int32_t>(step));
+        Ciphertext<Element> back  = cc->EvalRotate(ciphertext, static_cast<int32_t>(step) - block);
+        return cc->EvalAdd(cc->EvalMult(front, mask.first), cc->EvalMult(back, mask.second));
+    }
+
+    // 각 block의 [begin, end) 밖의 슬롯을 0으로 (예: EvalAdd(ct, 상수)로 채워진 padding 슬롯 정리). 레벨 1 소모
+    Ciphertext<Element> isolate(ConstCiphertext<Element> ciphertext, size_t begin, size_t end) const {
+        return cc->EvalMult(ciphertext, cc->MakeCKKSPackedPlaintext(packer.blockMask(begin, end)));
+    }
+};
+
+}  // namespace lbcrypto
+
+#endif
@@ -0,0 +1,171 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  OpenFHE backend for TracedCiphertext (traced-ciphertext.h)
+  TraceableCiphertext<Element>(traceable-ciphertext.h)는 이 backend를 쓰는 TracedCiphertext
+  rescale(): SEALTraceBackend와 같은 의미. noise scale degree가 2 이상이면 ScalingTechnique와 관계없이 지금 rescale
+  (cc->Rescale은 FIXEDMANUAL에서만 동작하고 FLEXIBLEAUTO 등에서는 아무것도 하지 않으므로 scheme의 ModReduceInternal을 직접 호출)
+  CryptoContext의 연산은 여러 스레드에서 호출 가능
+ */
+
+#ifndef LBCRYPTO_TRACE_OPENFHE_TRACE_BACKEND_H
+#define LBCRYPTO_TRACE_OPENFHE_TRACE_BACKEND_H
+
+#include "openfhe.h"
+#include "traced-ciphertext.h"
+
+namespace lbcrypto {
+
+template <typename Element>
+class OpenFHETraceBackend {
+public:
+    using Ciphertext = lbcrypto::Ciphertext<Element>;
+
+private:
+    CryptoContext<Element> cryptoContext;
+    KeyPair<Element> keys;
+
+public:
+    // keys.secretKey로 EvalMultKeyGen, 사용할 회전 index로 EvalRotateKeyGen이 되어 있어야 함
+    OpenFHETraceBackend(const CryptoContext<Element>& cc, const KeyPair<Element>& keys) : cryptoContext(cc), keys(keys) {}
+
+    static const char* name() {
+        return "OpenFHE";
+    }
+
+    const CryptoContext<Element>& getCryptoContext() const {
+        return cryptoContext;
+    }
+
+    const KeyPair<Element>& getKeyPair() const {
+        return keys;
+    }
+
+    size_t slotCount() const {
+        size_t batchSize = cryptoContext->GetEncodingParams()->GetBatchSize();
+        return batchSize ? batchSize : cryptoContext->GetRingDimension() / 2;
+    }
+
+    Ciphertext encrypt(const std::vector<std::complex<double>>& values) {
+        return cryptoContext->Encrypt(keys.publicKey, cryptoContext->MakeCKKSPackedPlaintext(values));
+    }
+
+    std::vector<std::complex<double>> decrypt(const Ciphertext& ct) {
+        Plaintext result;
+        cryptoContext->Decrypt(ct, keys.secretKey, &result);
+        return result->GetCKKSPackedValue();
+    }
+
+    Ciphertext clone(const Ciphertext& a) {
+        return a->Clone();
+    }
+
+    Ciphertext add(const Ciphertext& a, const Ciphertext& b) {
+        return cryptoContext->EvalAdd(a, b);
+    }
+
+    Ciphertext addConst(const Ciphertext& a, double constant) {
+        return cryptoContext->EvalAdd(a, constant);
+    }
+
+    Ciphertext sub(const Ciphertext& a, const Ciphertext& b) {
+        return cryptoContext->EvalSub(a, b);
+    }
+
+    Ciphertext negate(const Ciphertext& a) {
+        return cryptoContext->EvalNegate(a);
+    }
+
+    void addInPlace(Ciphertext& a, const Ciphertext& b) {
+        cryptoContext->EvalAddInPlace(a, b);
+    }
+
+    void addConstInPlace(Ciphertext& a, double constant) {
+        cryptoContext->EvalAddInPlace(a, constant);
+    }
+
+    Ciphertext mult(const Ciphertext& a, const Ciphertext& b) {
+        return cryptoContext->EvalMult(a, b);
+    }
+
+    Ciphertext square(const Ciphertext& a) {     // EvalMult(a, a)보다 다항식 곱이 하나 적음
+        return cryptoContext->EvalSquare(a);
+    }
+
+    Ciphertext multConst(const Ciphertext& a, double constant) {
+        return cryptoContext->EvalMult(a, constant);
+    }
+
+    void multConstInPlace(Ciphertext& a, double constant) {
+        cryptoContext->EvalMultInPlace(a, constant);
+    }
+
+    Ciphertext linearWSum(const std::vector<Ciphertext>& terms, const std::vector<double>& weights) {
+        std::vector<ConstCiphertext<Element>> ciphertexts(terms.begin(), terms.end());
+        return cryptoContext->EvalLinearWSum(ciphertexts, weights);
+    }
+
+    Ciphertext rotate(const Ciphertext& a, int32_t index) {
+        return cryptoContext->EvalRotate(a, index);
+    }
+
+    // 키 스위칭의 digit decomposition을 한 번만 계산(hoisting)하고 모든 회전에서 재사용
+    std::vector<Ciphertext> rotate(const Ciphertext& a, const std::vector<int32_t>& indices) {
+        std::vector<Ciphertext> results;
+        results.reserve(indices.size());
+        auto precomp     = cryptoContext->EvalFastRotationPrecompute(a);
+        const uint32_t m = cryptoContext->GetCyclotomicOrder();
+        for (int32_t index : indices)
+            results.push_back(cryptoContext->EvalFastRotation(a, index, m, precomp));
+        return results;
+    }
+
+    Ciphertext rescale(const Ciphertext& a) {
+        if (a->GetNoiseScaleDeg() < 2)
+            return a;
+        return cryptoContext->GetScheme()->ModReduceInternal(a, 1);
+    }
+
+    TraceInfo info(const Ciphertext& ct) const {
+        TraceInfo info;
+        info.level         = ct->GetLevel();
+        info.noiseScaleDeg = ct->GetNoiseScaleDeg();
+        info.scalingFactor = ct->GetScalingFactor();
+        for (const auto& poly : ct->GetElements())   // 다항식 수 * RNS limb 수 * N * 8바이트
+            info.bytes += static_cast<uint64_t>(poly.GetNumOfElements()) * poly.GetRingDimension() * sizeof(uint64_t);
+        return info;
+    }
+};
+
+}  // namespace lbcrypto
+
+#endif
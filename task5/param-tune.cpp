@@ -0,0 +1,149 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  CKKS parameter tuning
+  traceable-cipher-test가 저장한 회로(traceable-cipher-test.trace)를 후보 파라미터마다 다시 실행해서
+  필요한 정밀도를 만족하는 가장 빠른 파라미터를 ckks-params.cfg로 저장 (traceable-cipher-test가 다음 실행부터 사용)
+  --dry-run: 키 생성, 실행 없이 후보마다 정적 분석(BudgetAnalyzer) 결과만 출력
+ */
+
+#include "openfhe.h"
+#include "param-tuner.h"
+
+#include <sstream>
+
+using namespace lbcrypto;
+
+// 사용법: param-tune [traceable-cipher-test.trace] [--bits 20] [--batch 8] [--reps 3] [--scales 30,40,50]
+//                    [--output ckks-params.cfg] [--margin 5] [--dry-run]
+int main(int argc, char* argv[]) {
+    std::string tracePath = "traceable-cipher-test.trace", outputPath = "ckks-params.cfg";
+    double requiredBits = 20;
+    uint32_t batchSize  = 8;
+    size_t reps         = 3;
+    double margin       = 5;
+    bool dryRun         = false;
+    std::vector<uint32_t> scales;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--bits" && i + 1 < argc)
+            requiredBits = std::stod(argv[++i]);
+        else if (arg == "--batch" && i + 1 < argc)
+            batchSize = std::stoul(argv[++i]);
+        else if (arg == "--reps" && i + 1 < argc)
+            reps = std::stoul(argv[++i]);
+        else if (arg == "--margin" && i + 1 < argc)
+            margin = std::stod(argv[++i]);
+        else if (arg == "--dry-run")
+            dryRun = true;
+        else if (arg == "--output" && i + 1 < argc)
+            outputPath = argv[++i];
+        else if (arg == "--scales" && i + 1 < argc) {
+            std::stringstream ss(argv[++i]);
+            std::string item;
+            while (std::getline(ss, item, ','))
+                scales.push_back(std::stoul(item));
+        }
+        else
+            tracePath = arg;
+    }
+
+    std::ifstream in(tracePath, std::ios::binary);
+    if (!in) {
+        std::cout << "Cannot read " << tracePath << " (run traceable-cipher-test first)" << std::endl;
+        return 1;
+    }
+    std::vector<TraceNode> nodes = TraceRecorder::loadBinary(in);
+
+    // traceable-cipher-test와 같은 입력 범위
+    std::vector<std::complex<double>> input(batchSize);
+    for (size_t i = 0; i < input.size(); ++i)
+        input[i] = 1.0 + 0.01 * static_cast<double>(i);
+
+    ParamTuner tuner(nodes, input, batchSize);
+    tuner.setRepetitions(reps);
+    tuner.setStaticPrecisionMargin(margin);
+    if (!scales.empty())
+        tuner.setScalingModSizes(scales);
+
+    std::cout << nodes.size() << " ops, multiplicative depth " << tuner.circuitDepth() << ", "
+              << tuner.rotationIndices().size() << " rotation indices, required precision " << requiredBits << " bits"
+              << std::endl;
+
+    std::cout << std::fixed << std::setprecision(2);
+    if (dryRun) {
+        std::cout << std::setw(7) << "N" << std::setw(7) << "depth" << std::setw(7) << "scale" << std::setw(7) << "first"
+                  << std::setw(6) << "dnum" << std::setw(10) << "headroom" << std::setw(8) << "bits" << std::setw(10)
+                  << "time(us)" << std::endl;
+        for (const CKKSParams& p : tuner.candidates()) {
+            BudgetReport report = tuner.analyzeBudget(p, requiredBits);
+            std::cout << std::setw(7) << p.ringDim << std::setw(7) << p.multiplicativeDepth << std::setw(7)
+                      << p.scalingModSize << std::setw(7) << p.firstModSize << std::setw(6) << p.numLargeDigits
+                      << std::setw(10) << report.minHeadroomBits << std::setw(8) << report.precisionBits
+                      << std::setw(10) << report.analysisUs;
+            std::cout << (report.feasible() ? "" : "  infeasible: " + report.summary()) << std::endl;
+        }
+        return 0;
+    }
+
+    std::vector<TunerResult> results;
+    int best = tuner.tune(requiredBits, results);
+
+    std::cout << std::setw(7) << "N" << std::setw(7) << "depth" << std::setw(7) << "scale" << std::setw(7) << "first"
+              << std::setw(6) << "dnum" << std::setw(8) << "logQP" << std::setw(12) << "latency(ms)" << std::setw(8)
+              << "bits" << std::endl;
+    for (size_t i = 0; i < results.size(); ++i) {
+        const TunerResult& r = results[i];
+        const CKKSParams& p  = r.params;
+        std::cout << std::setw(7) << p.ringDim << std::setw(7) << p.multiplicativeDepth << std::setw(7)
+                  << p.scalingModSize << std::setw(7) << p.firstModSize << std::setw(6) << p.numLargeDigits
+                  << std::setw(8) << p.estimatedLogQP();
+        if (r.ran)
+            std::cout << std::setw(12) << r.latencyMs << std::setw(8) << r.precisionBits;
+        else if (r.skipped)
+            std::cout << "  skipped (static): " << r.error;
+        else
+            std::cout << "  failed: " << r.error;
+        std::cout << (static_cast<int>(i) == best ? "  <- selected" : "") << std::endl;
+    }
+
+    if (best < 0) {
+        std::cout << "No candidate reaches " << requiredBits << " bits" << std::endl;
+        return 1;
+    }
+    if (!results[best].params.save(outputPath)) {
+        std::cout << "Cannot write " << outputPath << std::endl;
+        return 1;
+    }
+    std::cout << "Saved " << results[best].params.tag() << " to " << outputPath << std::endl;
+    return 0;
+}
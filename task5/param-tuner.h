@@ -0,0 +1,475 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  CKKS parameter auto-tuner
+  기록된 회로(TraceRecorder 노드)와 필요한 정밀도(bit)를 받아
+  (ring dimension, scaling mod size, first mod size, dnum) 후보를 만들고, 후보마다 회로를 실제로 실행해서
+  정밀도를 만족하는 후보 중 가장 빠른 것을 고름. 결과는 CKKSParams로 저장해 다른 프로그램에서 재사용
+  - multiplicative depth는 회로에서 계산 (곱셈 노드 수가 가장 많은 경로)
+  - ring dimension은 log2(QP) 추정치가 128-bit 보안 한도 안에 드는 가장 작은 값. 최종 판단은 GenCryptoContext의 보안 검사
+  - 후보를 바꿀 때 전역 key map과 CryptoContext를 모두 해제하므로 다른 CryptoContext를 쓰는 중에는 호출하지 말 것
+  - 키 생성 전에 BudgetAnalyzer(budget-analyzer.h)로 레벨, 스케일, 추정 정밀도를 확인해서 안 되는 후보는 실행하지 않음
+ */
+
+#ifndef LBCRYPTO_TRACE_PARAM_TUNER_H
+#define LBCRYPTO_TRACE_PARAM_TUNER_H
+
+#include "openfhe.h"
+#include "budget-analyzer.h"
+#include "precision-analyzer.h"
+#include "shadow-kernels.h"
+#include "trace-recorder.h"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <set>
+#include <sstream>
+
+namespace lbcrypto {
+
+// ------------------------------- CKKSParams
+struct CKKSParams {
+    uint32_t ringDim             = 0;
+    uint32_t multiplicativeDepth = 0;
+    uint32_t scalingModSize      = 0;
+    uint32_t firstModSize        = 0;
+    uint32_t numLargeDigits      = 0;  // dnum
+    uint32_t batchSize           = 0;
+
+    // 128-bit 보안에서 ring dimension별 최대 log2(QP) (HE 표준, SEAL CoeffModulus::MaxBitCount와 같은 값)
+    static uint32_t maxLogQP(uint32_t ringDim) {
+        static const std::map<uint32_t, uint32_t> table = {
+            {1024, 27}, {2048, 54}, {4096, 109}, {8192, 218}, {16384, 438}, {32768, 881}, {65536, 1761}};
+        auto it = table.find(ringDim);
+        return it == table.end() ? 0 : it->second;
+    }
+
+    // log2(Q) + log2(P). P는 digit 하나(log2(Q) / dnum)를 덮는 60-bit 소수들로 추정
+    uint32_t estimatedLogQP() const {
+        const uint32_t logQ  = firstModSize + multiplicativeDepth * scalingModSize;
+        const uint32_t digit = (logQ + numLargeDigits - 1) / numLargeDigits;
+        return logQ + (digit + 59) / 60 * 60;
+    }
+
+    // 추정치가 보안 한도 안에 들고 슬롯이 batchSize 이상인 가장 작은 ring dimension (없으면 0)
+    uint32_t minimumRingDim() const {
+        for (uint32_t n = 1024; n <= 65536; n *= 2) {
+            if (n / 2 >= batchSize && estimatedLogQP() <= maxLogQP(n))
+                return n;
+        }
+        return 0;
+    }
+
+    // 소수를 2^bits로 근사한 modulus chain (키, context 없이 정적 분석용)
+    ModulusChain modulusChain() const {
+        return ModulusChain::fromBits(ringDim, firstModSize, scalingModSize, multiplicativeDepth);
+    }
+
+    void apply(CCParams<CryptoContextCKKSRNS>& parameters) const {
+        parameters.SetMultiplicativeDepth(multiplicativeDepth);
+        parameters.SetScalingModSize(scalingModSize);
+        parameters.SetFirstModSize(firstModSize);
+        parameters.SetNumLargeDigits(numLargeDigits);
+        parameters.SetScalingTechnique(FLEXIBLEAUTO);
+        parameters.SetSecurityLevel(HEStd_128_classic);
+        parameters.SetRingDim(ringDim);
+        if (batchSize)
+            parameters.SetBatchSize(batchSize);
+    }
+
+    // 키 스냅샷 tag 등에 사용
+    std::string tag() const {
+        std::ostringstream os;
+        os << "N" << ringDim << "-depth" << multiplicativeDepth << "-scale" << scalingModSize << "-first"
+           << firstModSize << "-dnum" << numLargeDigits << "-batch" << batchSize;
+        return os.str();
+    }
+
+    // 텍스트 파일: 한 줄에 key=value
+    bool save(const std::string& path) const {
+        std::ofstream out(path);
+        if (!out)
+            return false;
+        out << "# CKKS parameters (FLEXIBLEAUTO, HEStd_128_classic)\n"
+            << "ringDim=" << ringDim << "\n"
+            << "multiplicativeDepth=" << multiplicativeDepth << "\n"
+            << "scalingModSize=" << scalingModSize << "\n"
+            << "firstModSize=" << firstModSize << "\n"
+            << "numLargeDigits=" << numLargeDigits << "\n"
+            << "batchSize=" << batchSize << "\n";
+        return static_cast<bool>(out);
+    }
+
+    bool load(const std::string& path) {
+        std::ifstream in(path);
+        if (!in)
+            return false;
+        std::map<std::string, uint32_t*> fields = {{"ringDim", &ringDim},
+                                                   {"multiplicativeDepth", &multiplicativeDepth},
+                                                   {"scalingModSize", &scalingModSize},
+                                                   {"firstModSize", &firstModSize},
+                                                   {"numLargeDigits", &numLargeDigits},
+                                                   {"batchSize", &batchSize}};
+        std::string line;
+        while (std::getline(in, line)) {
+            size_t eq = line.find('=');
+            if (line.empty() || line[0] == '#' || eq == std::string::npos)
+                continue;
+            auto it = fields.find(line.substr(0, eq));
+            if (it != fields.end())
+                *it->second = static_cast<uint32_t>(std::stoul(line.substr(eq + 1)));
+        }
+        return ringDim != 0 && multiplicativeDepth != 0;
+    }
+};
+
+// ------------------------------- TunerResult
+struct TunerResult {
+    CKKSParams params;
+    bool ran             = false;  // 실행 성공 여부 (보안 검사 실패, 레벨 부족이면 false)
+    bool skipped         = false;  // 정적 분석에서 탈락해서 키 생성 없이 건너뜀 (error에 이유)
+    double estimatedBits = 0;      // 정적 분석의 추정 정밀도
+    double latencyMs     = 0;      // 회로 1회 실행 시간 (중앙값)
+    double precisionBits = 0;      // 출력 노드 중 가장 낮은 정밀도
+    std::string error;
+};
+
+// ------------------------------- ParamTuner
+class ParamTuner {
+private:
+    std::vector<TraceNode> nodes;
+    std::vector<std::complex<double>> input;
+    uint32_t batchSize;
+    std::vector<uint32_t> scalingModSizes = {30, 35, 40, 45, 50, 55};
+    std::vector<uint32_t> digitCounts     = {1, 2, 3};
+    size_t reps                           = 3;
+    double precisionMargin                = 5;
+
+    static bool isMult(const std::string& op) {
+        return op == "cipherMult" || op == "cipherMult(const)" || op == "cipherSquare" || op == "cipherLinearWSum";
+    }
+
+    static bool parseRotation(const std::string& op, int32_t& index) {
+        static const std::string prefix = "cipherRotate(";
+        if (op.compare(0, prefix.size(), prefix) != 0)
+            return false;
+        index = std::stoi(op.substr(prefix.size()));
+        return true;
+    }
+
+    // 다른 노드의 피연산자로 쓰이지 않는 노드 = 회로의 출력
+    std::vector<size_t> outputs() const {
+        std::vector<bool> used(nodes.size() + 1, false);
+        for (const auto& n : nodes) {
+            for (uint64_t operand : n.operands)
+                if (operand <= nodes.size())
+                    used[operand] = true;
+        }
+        std::vector<size_t> result;
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            if (!used[nodes[i].id])
+                result.push_back(i);
+        }
+        return result;
+    }
+
+    // 노드 순서(기록 순서 = 위상 순서)대로 재실행. shadow가 nullptr가 아니면 평문으로도 계산
+    void replay(const CryptoContext<DCRTPoly>& cc, const Ciphertext<DCRTPoly>& in,
+                std::vector<Ciphertext<DCRTPoly>>& values,
+                std::vector<std::vector<std::complex<double>>>* shadow) const {
+        values.assign(nodes.size() + 1, nullptr);
+        if (shadow)
+            shadow->assign(nodes.size() + 1, {});
+        for (const auto& n : nodes) {
+            auto arg = [&](size_t i) -> const Ciphertext<DCRTPoly>& { return values.at(n.operands.at(i)); };
+            int32_t index = 0;
+            if (n.op == "input")
+                values[n.id] = in;
+            else if (n.op == "cipherAdd(const)")
+                values[n.id] = cc->EvalAdd(arg(0), n.constant);
+            else if (n.op == "cipherAdd")
+                values[n.id] = cc->EvalAdd(arg(0), arg(1));
+            else if (n.op == "cipherSub")
+                values[n.id] = cc->EvalSub(arg(0), arg(1));
+            else if (n.op == "cipherNegate")
+                values[n.id] = cc->EvalNegate(arg(0));
+            else if (n.op == "cipherMult")
+                values[n.id] = cc->EvalMult(arg(0), arg(1));
+            else if (n.op == "cipherSquare")
+                values[n.id] = cc->EvalSquare(arg(0));
+            else if (n.op == "cipherMult(const)")
+                values[n.id] = cc->EvalMult(arg(0), n.constant);
+            else if (n.op == "cipherLinearWSum") {
+                std::vector<ConstCiphertext<DCRTPoly>> terms;
+                for (uint64_t operand : n.operands)
+                    terms.push_back(values.at(operand));
+                values[n.id] = cc->EvalLinearWSum(terms, n.weights);
+                if (n.constant != 0)
+                    cc->EvalAddInPlace(values[n.id], n.constant);
+            }
+            else if (n.op == "cipherRescale")     // 후보는 모두 FLEXIBLEAUTO: 다음 연산이 필요할 때 rescale하므로 그대로 전달
+                values[n.id] = arg(0);
+            else if (parseRotation(n.op, index))
+                values[n.id] = cc->EvalRotate(arg(0), index);
+            else
+                throw std::runtime_error("ParamTuner: unsupported op " + n.op);
+
+            if (!shadow)
+                continue;
+            auto& out       = (*shadow)[n.id];
+            const auto& src = n.operands.empty() ? input : (*shadow)[n.operands[0]];
+            if (index != 0) {
+                ShadowRotate(out, src, index, batchSize);
+                continue;
+            }
+            if (n.op == "cipherLinearWSum") {
+                out.assign(src.size(), 0);
+                for (size_t i = 0; i < n.operands.size(); ++i)
+                    ShadowAxpyInPlace(out, (*shadow)[n.operands[i]], n.weights.at(i));
+                ShadowAddInPlace(out, n.constant);
+                continue;
+            }
+            out = src;      // cipherRescale: 값은 그대로
+            if (n.op == "cipherAdd(const)")
+                ShadowAddInPlace(out, n.constant);
+            else if (n.op == "cipherAdd")
+                ShadowAddInPlace(out, (*shadow)[n.operands[1]]);
+            else if (n.op == "cipherSub")
+                ShadowAxpyInPlace(out, (*shadow)[n.operands[1]], -1.0);
+            else if (n.op == "cipherNegate")
+                ShadowMultInPlace(out, -1.0);
+            else if (n.op == "cipherMult")
+                ShadowMultInPlace(out, (*shadow)[n.operands[1]]);
+            else if (n.op == "cipherSquare")    // TraceableCiphertext는 피연산자를 두 번, CircuitBuilder는 한 번 기록
+                ShadowMultInPlace(out, src);
+            else if (n.op == "cipherMult(const)")
+                ShadowMultInPlace(out, n.constant);
+        }
+    }
+
+public:
+    // input: 회로 입력 예시 (정밀도 측정용), batchSize: 회로의 슬롯 수
+    ParamTuner(std::vector<TraceNode> circuit, std::vector<std::complex<double>> input, uint32_t batchSize)
+        : nodes(std::move(circuit)), input(std::move(input)), batchSize(batchSize) {
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            if (nodes[i].id != i + 1)
+                throw std::invalid_argument("ParamTuner: node ids must be 1..n in recording order");
+            for (uint64_t operand : nodes[i].operands) {
+                if (operand == 0 || operand > i)
+                    throw std::invalid_argument("ParamTuner: node " + std::to_string(i + 1) + " has an unrecorded operand");
+            }
+        }
+    }
+
+    void setScalingModSizes(std::vector<uint32_t> sizes) {
+        scalingModSizes = std::move(sizes);
+    }
+
+    void setDigitCounts(std::vector<uint32_t> counts) {
+        digitCounts = std::move(counts);
+    }
+
+    void setRepetitions(size_t count) {
+        reps = std::max<size_t>(1, count);
+    }
+
+    // 정적 분석의 추정 정밀도 + margin이 필요한 정밀도보다 낮은 후보만 건너뜀 (추정치는 보수적인 상한 기준)
+    void setStaticPrecisionMargin(double bits) {
+        precisionMargin = bits;
+    }
+
+    // 키 생성 없이 후보의 레벨, 스케일, 추정 정밀도 확인. 입력 크기는 정밀도 측정용 입력의 최대 절댓값
+    BudgetReport analyzeBudget(const CKKSParams& params, double requiredBits) const {
+        double magnitude = 0;
+        for (const auto& v : input)
+            magnitude = std::max(magnitude, std::abs(v));
+        BudgetAnalyzer analyzer(params.modulusChain());
+        if (magnitude > 0)
+            analyzer.setInputMagnitude(magnitude);
+        analyzer.setRequiredBits(requiredBits - precisionMargin);
+        return analyzer.analyze(nodes);
+    }
+
+    // 입력에서 출력까지 곱셈(암호문*암호문, 암호문*상수) 노드가 가장 많은 경로의 길이
+    uint32_t circuitDepth() const {
+        std::vector<uint32_t> depth(nodes.size() + 1, 0);
+        uint32_t result = 0;
+        for (const auto& n : nodes) {
+            uint32_t d = 0;
+            for (uint64_t operand : n.operands)
+                d = std::max(d, depth.at(operand));
+            depth[n.id] = d + (isMult(n.op) ? 1 : 0);
+            result      = std::max(result, depth[n.id]);
+        }
+        return result;
+    }
+
+    std::vector<int32_t> rotationIndices() const {
+        std::set<int32_t> indices;
+        int32_t index;
+        for (const auto& n : nodes) {
+            if (parseRotation(n.op, index))
+                indices.insert(index);
+        }
+        return std::vector<int32_t>(indices.begin(), indices.end());
+    }
+
+    // 후보 목록: scaling mod size × dnum. dnum은 limb 수(depth + 1)를 넘지 않음
+    std::vector<CKKSParams> candidates() const {
+        std::vector<CKKSParams> result;
+        const uint32_t depth = std::max<uint32_t>(1, circuitDepth());
+        for (uint32_t scale : scalingModSizes) {
+            for (uint32_t dnum : digitCounts) {
+                if (dnum > depth + 1)
+                    continue;
+                CKKSParams p;
+                p.multiplicativeDepth = depth;
+                p.scalingModSize      = scale;
+                p.firstModSize        = std::min<uint32_t>(60, scale + 10);
+                p.numLargeDigits      = dnum;
+                p.batchSize           = batchSize;
+                p.ringDim             = p.minimumRingDim();
+                if (p.ringDim)
+                    result.push_back(p);
+            }
+        }
+        return result;
+    }
+
+    // 후보 하나를 실행: context 생성, 키 생성, 회로 reps번 실행 (중앙값), 출력 노드의 정밀도 측정
+    TunerResult evaluate(const CKKSParams& params) const {
+        TunerResult result;
+        result.params = params;
+        try {
+            CCParams<CryptoContextCKKSRNS> parameters;
+            params.apply(parameters);
+            CryptoContext<DCRTPoly> cc = GenCryptoContext(parameters);
+            cc->Enable(PKE);
+            cc->Enable(KEYSWITCH);
+            cc->Enable(LEVELEDSHE);
+            auto keys = cc->KeyGen();
+            cc->EvalMultKeyGen(keys.secretKey);
+            std::vector<int32_t> indices = rotationIndices();
+            if (!indices.empty())
+                cc->EvalRotateKeyGen(keys.secretKey, indices);
+
+            auto in = cc->Encrypt(keys.publicKey, cc->MakeCKKSPackedPlaintext(input));
+            std::vector<Ciphertext<DCRTPoly>> values;
+            std::vector<std::vector<std::complex<double>>> shadow;
+            replay(cc, in, values, &shadow);    // warm-up + 평문 결과
+
+            std::vector<double> times;
+            for (size_t r = 0; r < reps; ++r) {
+                auto start = std::chrono::steady_clock::now();
+                replay(cc, in, values, nullptr);
+                times.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+            }
+            std::sort(times.begin(), times.end());
+            result.latencyMs = times[times.size() / 2];
+
+            PrecisionAnalyzer analyzer;
+            result.precisionBits = std::numeric_limits<double>::infinity();
+            for (size_t i : outputs()) {
+                Plaintext decrypted;
+                cc->Decrypt(keys.secretKey, values[nodes[i].id], &decrypted);
+                decrypted->SetLength(batchSize);
+                PrecisionReport report =
+                    analyzer.analyze(nodes[i].op, decrypted->GetCKKSPackedValue(), shadow[nodes[i].id]);
+                result.precisionBits = std::min(result.precisionBits, report.precisionBits);
+            }
+            result.ran = true;
+        }
+        catch (const std::exception& e) {
+            result.error = e.what();
+        }
+        CryptoContextImpl<DCRTPoly>::ClearEvalMultKeys();
+        CryptoContextImpl<DCRTPoly>::ClearEvalAutomorphismKeys();
+        CryptoContextFactory<DCRTPoly>::ReleaseAllContexts();
+        return result;
+    }
+
+    // 모든 후보를 실행해서 결과 목록에 넣고, 정밀도를 만족하는 가장 빠른 후보의 위치를 반환 (없으면 -1)
+    // 정적 분석에서 레벨이 부족하면 depth를 1 늘린 후보로 바꾸고, 그래도 안 되면 실행하지 않음
+    // 레벨 부족으로 실행에 실패한 후보는 depth를 1 늘려서 한 번 더 시도
+    int tune(double requiredBits, std::vector<TunerResult>& results) const {
+        results.clear();
+        int best = -1;
+        for (CKKSParams params : candidates()) {
+            BudgetReport budget = analyzeBudget(params, requiredBits);
+            if (!budget.feasible()) {
+                CKKSParams deeper = params;
+                deeper.multiplicativeDepth++;
+                deeper.ringDim = deeper.minimumRingDim();
+                if (deeper.ringDim) {
+                    BudgetReport retry = analyzeBudget(deeper, requiredBits);
+                    if (retry.feasible()) {
+                        params = deeper;
+                        budget = retry;
+                    }
+                }
+            }
+            if (!budget.feasible()) {
+                TunerResult skipped;
+                skipped.params        = params;
+                skipped.skipped       = true;
+                skipped.estimatedBits = budget.precisionBits;
+                skipped.error         = budget.summary();
+                results.push_back(skipped);
+                continue;
+            }
+
+            TunerResult result = evaluate(params);
+            if (!result.ran) {
+                params.multiplicativeDepth++;
+                params.ringDim = params.minimumRingDim();
+                if (params.ringDim) {
+                    TunerResult retry = evaluate(params);
+                    if (retry.ran)
+                        result = retry;
+                }
+            }
+            result.estimatedBits = budget.precisionBits;
+            results.push_back(result);
+            const bool ok = result.ran && result.precisionBits >= requiredBits;
+            if (ok && (best < 0 || result.latencyMs < results[best].latencyMs))
+                best = static_cast<int>(results.size()) - 1;
+        }
+        return best;
+    }
+};
+
+}  // namespace lbcrypto
+
+#endif
@@ -0,0 +1,349 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Depth-optimal polynomial evaluation (baby-step giant-step / Paterson-Stockmeyer) for CKKS
+  Backend-agnostic: the backend supplies ciphertext ct*ct, ct*const, ct+ct, ct+const and negate
+ */
+
+#ifndef LBCRYPTO_TRACE_POLY_EVALUATOR_H
+#define LBCRYPTO_TRACE_POLY_EVALUATOR_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <map>
+#include <queue>
+#include <stdexcept>
+#include <vector>
+
+namespace lbcrypto {
+
+// 평가 비용. depth = 소모한 곱셈 레벨 수, ctMults = 암호문*암호문 곱셈(relinearization 포함) 수
+struct PolyCost {
+    uint32_t depth       = 0;
+    uint32_t ctMults     = 0;
+    uint32_t scalarMults = 0;   // 상수 곱셈(레벨 1 소모)
+    uint32_t adds        = 0;
+
+    bool operator<(const PolyCost& other) const {   // depth 우선, 다음으로 ctMults
+        if (depth != other.depth)
+            return depth < other.depth;
+        if (ctMults != other.ctMults)
+            return ctMults < other.ctMults;
+        return scalarMults < other.scalarMults;
+    }
+};
+
+// 암호문 없이 비용만 계산하는 backend. PolyEvaluator가 baby step 크기를 고를 때 사용
+struct SymbolicPolyBackend {
+    struct Ciphertext {};
+
+    Ciphertext mult(const Ciphertext&, const Ciphertext&) { return {}; }
+    Ciphertext square(const Ciphertext&) { return {}; }
+    Ciphertext multConst(const Ciphertext&, double) { return {}; }
+    Ciphertext add(const Ciphertext&, const Ciphertext&) { return {}; }
+    Ciphertext addConst(const Ciphertext&, double) { return {}; }
+    Ciphertext negate(const Ciphertext&) { return {}; }
+};
+
+// ------------------------------- PolyEvaluator
+// p(x) = sum c_i x^i 를 baby step k (2의 거듭제곱)로 나누어 평가:
+//   p = q * x^(k*2^j) + r (재귀), 잎에서는 sum_{i<k} c_i x^i 를 상수 곱셈으로 계산
+// k 후보를 모두 SymbolicPolyBackend로 시뮬레이션해서 depth가 가장 작은 k 중 ctMults가 가장 작은 k를 선택
+// (depth = ceil(log2(d+1)). 상수 곱셈이 레벨을 1 소모하므로 k가 크면 depth가 1 늘어남)
+// 계수가 ±1이거나 작은 정수면 상수 곱셈 대신 negate/덧셈으로 처리해서 레벨을 소모하지 않음
+template <typename Backend>
+class PolyEvaluator {
+    template <typename>
+    friend class PolyEvaluator;
+
+public:
+    using Ciphertext = typename Backend::Ciphertext;
+
+    static constexpr double MAX_INTEGER_BY_ADDITION = 16;   // 이 이하의 정수 계수는 덧셈으로 곱함
+
+private:
+    struct Value {
+        Ciphertext ct;
+        uint32_t depth = 0;
+    };
+
+    // 암호문 항이 없고 상수만 있을 수 있는 부분 결과
+    struct Partial {
+        bool hasCt = false;
+        Value value;
+        double constant = 0;
+    };
+
+    Backend& backend;
+    PolyCost cost;
+    std::map<uint32_t, Value> powers;   // x^i 캐시
+
+    Value mult(const Value& a, const Value& b) {
+        ++cost.ctMults;
+        Value r{backend.mult(a.ct, b.ct), std::max(a.depth, b.depth) + 1};
+        cost.depth = std::max(cost.depth, r.depth);
+        return r;
+    }
+
+    Value square(const Value& a) {
+        ++cost.ctMults;
+        Value r{backend.square(a.ct), a.depth + 1};
+        cost.depth = std::max(cost.depth, r.depth);
+        return r;
+    }
+
+    Value add(const Value& a, const Value& b) {
+        ++cost.adds;
+        return Value{backend.add(a.ct, b.ct), std::max(a.depth, b.depth)};
+    }
+
+    static bool isSmallInteger(double c) {
+        return c == std::round(c) && std::fabs(c) <= MAX_INTEGER_BY_ADDITION;
+    }
+
+    // c * v. ±1, 작은 정수는 레벨 소모 없이 처리
+    Value scalar(double c, const Value& v) {
+        if (c == 1)
+            return v;
+        if (c == -1)
+            return Value{backend.negate(v.ct), v.depth};
+        if (isSmallInteger(c)) {    // double-and-add
+            uint64_t n = static_cast<uint64_t>(std::fabs(c));
+            Value acc;
+            bool hasAcc = false;
+            Value base  = v;
+            while (n) {
+                if (n & 1) {
+                    acc    = hasAcc ? add(acc, base) : base;
+                    hasAcc = true;
+                }
+                n >>= 1;
+                if (n)
+                    base = add(base, base);
+            }
+            return c < 0 ? Value{backend.negate(acc.ct), acc.depth} : acc;
+        }
+        ++cost.scalarMults;
+        Value r{backend.multConst(v.ct, c), v.depth + 1};
+        cost.depth = std::max(cost.depth, r.depth);
+        return r;
+    }
+
+    static uint32_t highestPowerOfTwoBelow(uint32_t i) {  // i보다 작은 가장 큰 2의 거듭제곱
+        uint32_t p = 1;
+        while (p * 2 < i)
+            p *= 2;
+        return p;
+    }
+
+    // x^i = x^(2^t) * x^(i - 2^t), 2의 거듭제곱은 제곱. depth(x^i) = ceil(log2 i)
+    const Value& power(uint32_t i) {
+        auto it = powers.find(i);
+        if (it != powers.end())
+            return it->second;
+        Value r;
+        if ((i & (i - 1)) == 0) {
+            r = square(power(i / 2));
+        }
+        else {
+            uint32_t p = highestPowerOfTwoBelow(i);
+            r          = mult(power(p), power(i - p));
+        }
+        return powers.emplace(i, r).first->second;
+    }
+
+    Partial leaf(const std::vector<double>& c, size_t lo, size_t hi) {  // sum_{i in [lo,hi)} c_i x^(i-lo)
+        Partial p;
+        p.constant = c[lo];
+        for (size_t i = lo + 1; i < hi; ++i) {
+            if (c[i] == 0)
+                continue;
+            Value term = scalar(c[i], power(static_cast<uint32_t>(i - lo)));
+            p.value    = p.hasCt ? add(p.value, term) : term;
+            p.hasCt    = true;
+        }
+        return p;
+    }
+
+    static bool allZero(const std::vector<double>& c, size_t lo, size_t hi) {
+        for (size_t i = lo; i < std::min(hi, c.size()); ++i) {
+            if (c[i] != 0)
+                return false;
+        }
+        return true;
+    }
+
+    // c[lo, lo + k*2^j) 구간의 다항식
+    Partial evalRecursive(const std::vector<double>& c, size_t lo, uint32_t k, uint32_t j) {
+        const size_t span = static_cast<size_t>(k) << j;
+        const size_t hi   = std::min(c.size(), lo + span);
+        if (j == 0)
+            return leaf(c, lo, hi);
+
+        const size_t half = span / 2;
+        Partial r         = evalRecursive(c, lo, k, j - 1);
+        if (lo + half >= hi || allZero(c, lo + half, hi))
+            return r;
+
+        Partial q       = evalRecursive(c, lo + half, k, j - 1);
+        const Value& xg = power(static_cast<uint32_t>(half));
+        Partial result;
+        result.hasCt = true;
+        if (q.hasCt) {
+            result.value = mult(q.value, xg);
+            if (q.constant != 0)
+                result.value = add(result.value, scalar(q.constant, xg));
+        }
+        else {
+            result.value = scalar(q.constant, xg);
+        }
+        result.constant = r.constant;
+        if (r.hasCt)
+            result.value = add(result.value, r.value);
+        return result;
+    }
+
+    Value finish(const Partial& p) {   // trimmed()를 거친 계수는 항상 x 항이 있음
+        if (p.constant == 0)
+            return p.value;
+        ++cost.adds;
+        return Value{backend.addConst(p.value.ct, p.constant), p.value.depth};
+    }
+
+    static uint32_t numGiantSteps(size_t terms, uint32_t k) {  // k * 2^j >= terms인 최소 j
+        uint32_t j = 0;
+        while ((static_cast<size_t>(k) << j) < terms)
+            ++j;
+        return j;
+    }
+
+    // 끝의 0 계수를 지운 계수. x 항이 없으면(빈 벡터, 상수 다항식) 평가할 암호문 연산이 없으므로 예외
+    static std::vector<double> trimmed(const std::vector<double>& coeffs) {
+        std::vector<double> c = coeffs;
+        while (c.size() > 1 && c.back() == 0)
+            c.pop_back();
+        if (c.empty())
+            throw std::invalid_argument("PolyEvaluator: no coefficients");
+        if (c.size() < 2)
+            throw std::invalid_argument("PolyEvaluator: constant polynomial");
+        return c;
+    }
+
+    Value evaluateWith(const Ciphertext& x, const std::vector<double>& c, uint32_t k) {
+        powers.clear();
+        powers.emplace(1, Value{x, 0});
+        return finish(evalRecursive(c, 0, k, numGiantSteps(c.size(), k)));
+    }
+
+public:
+    explicit PolyEvaluator(Backend& backend) : backend(backend) {}
+
+    const PolyCost& getCost() const {   // 마지막 evaluate 호출의 비용
+        return cost;
+    }
+
+    // baby step 크기와 그 비용 (암호문 연산 없음). 차수가 1 이상이어야 함 (아니면 std::invalid_argument)
+    // 최소 depth + depthSlack 이내인 k 중에서 ctMults가 가장 작은 k를 선택.
+    // depthSlack = 0: 최소 depth (k가 작아져 ctMults가 늘 수 있음), 1: Paterson-Stockmeyer에 가까운 곱셈 수
+    static std::pair<uint32_t, PolyCost> plan(const std::vector<double>& coeffs, uint32_t depthSlack = 0) {
+        std::vector<double> c = trimmed(coeffs);
+        SymbolicPolyBackend symbolic;
+        PolyEvaluator<SymbolicPolyBackend> sim(symbolic);
+        std::vector<std::pair<uint32_t, PolyCost>> candidates;
+        uint32_t minDepth = UINT32_MAX;
+        for (uint32_t k = 2; k / 2 < c.size(); k *= 2) {
+            sim.cost = PolyCost();
+            sim.evaluateWith(SymbolicPolyBackend::Ciphertext(), c, k);
+            candidates.emplace_back(k, sim.cost);
+            minDepth = std::min(minDepth, sim.cost.depth);
+        }
+        std::pair<uint32_t, PolyCost> best{0, PolyCost()};
+        for (const auto& cand : candidates) {
+            if (cand.second.depth > minDepth + depthSlack)
+                continue;
+            const PolyCost& a = cand.second;
+            const PolyCost& b = best.second;
+            if (best.first == 0 || a.ctMults < b.ctMults || (a.ctMults == b.ctMults && a < b))
+                best = cand;
+        }
+        return best;
+    }
+
+    // coeffs[i] = x^i의 계수. 빈 벡터나 상수 다항식은 std::invalid_argument
+    Ciphertext evaluate(const Ciphertext& x, const std::vector<double>& coeffs, uint32_t depthSlack = 0) {
+        std::vector<double> c = trimmed(coeffs);
+        uint32_t k            = plan(c, depthSlack).first;
+        cost                  = PolyCost();
+        return evaluateWith(x, c, k).ct;
+    }
+
+    // 인수분해된 형태: prod_f factors[f](x). 각 인수를 평가한 뒤 depth가 얕은 것끼리 먼저 곱함
+    // 상수 인수는 std::invalid_argument (상수는 다른 인수의 계수에 곱해서 넘길 것)
+    Ciphertext evaluateFactored(const Ciphertext& x, const std::vector<std::vector<double>>& factors) {
+        if (factors.empty())
+            throw std::invalid_argument("PolyEvaluator: no factors");
+        PolyCost total;
+        auto deeper = [](const Value& a, const Value& b) { return a.depth > b.depth; };
+        std::priority_queue<Value, std::vector<Value>, decltype(deeper)> heap(deeper);
+        std::vector<std::vector<double>> trimmedFactors;   // 암호문 연산 전에 모든 인수를 검사
+        for (const auto& f : factors)
+            trimmedFactors.push_back(trimmed(f));
+        std::map<std::vector<double>, Value> evaluated;    // 같은 인수는 한 번만 평가
+        for (const auto& c : trimmedFactors) {
+            auto it = evaluated.find(c);
+            if (it == evaluated.end()) {
+                cost    = PolyCost();
+                Value v = evaluateWith(x, c, plan(c).first);
+                total.ctMults += cost.ctMults;
+                total.scalarMults += cost.scalarMults;
+                total.adds += cost.adds;
+                it = evaluated.emplace(c, v).first;
+            }
+            heap.push(it->second);
+        }
+        cost = total;
+        while (heap.size() > 1) {
+            Value a = heap.top();
+            heap.pop();
+            Value b = heap.top();
+            heap.pop();
+            heap.push(mult(a, b));
+        }
+        cost.depth = heap.top().depth;
+        return heap.top().ct;
+    }
+};
+
+}  // namespace lbcrypto
+
+#endif
@@ -0,0 +1,279 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Full-slot precision analysis for TraceableCiphertext
+  복호화 결과와 original vector를 모든 슬롯에서 비교: 최대/평균 절대 오차, 정밀도(bit), 슬롯별 오차 히스토그램
+  결과는 PrecisionReport로 쌓아 두고 JSON/CSV로 내보냄. 정밀도가 기준보다 낮으면 alert 표시(선택적으로 handler 호출)
+ */
+
+#ifndef LBCRYPTO_TRACE_PRECISION_ANALYZER_H
+#define LBCRYPTO_TRACE_PRECISION_ANALYZER_H
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace lbcrypto {
+
+// err2[i] = |a[i] - b[i]|^2. 길이가 다르면 짧은 쪽의 부족한 슬롯은 0으로 간주
+// shadow-kernels.h와 같이 double 배열로 풀어서 계산 (SIMD 벡터화)
+inline void SquaredErrorKernel(std::vector<double>& err2, const std::vector<std::complex<double>>& a,
+                               const std::vector<std::complex<double>>& b) {
+    const size_t common = std::min(a.size(), b.size());
+    const size_t slots  = std::max(a.size(), b.size());
+    err2.resize(slots);
+    const double* x = reinterpret_cast<const double*>(a.data());
+    const double* y = reinterpret_cast<const double*>(b.data());
+    double* e       = err2.data();
+    for (size_t i = 0; i < common; ++i) {
+        const double dr = x[2 * i] - y[2 * i];
+        const double di = x[2 * i + 1] - y[2 * i + 1];
+        e[i]            = dr * dr + di * di;
+    }
+    const double* rest = a.size() > b.size() ? x : y;
+    for (size_t i = common; i < slots; ++i)
+        e[i] = rest[2 * i] * rest[2 * i] + rest[2 * i + 1] * rest[2 * i + 1];
+}
+
+// ------------------------------- PrecisionReport
+struct PrecisionReport {
+    static constexpr size_t HISTOGRAM_BINS = 64;
+
+    std::string label;
+    size_t slots             = 0;
+    double maxAbsError       = 0;
+    size_t maxErrorSlot      = 0;
+    double meanAbsError      = 0;
+    double precisionBits     = 0;  // -log2(최대 오차): OpenFHE GetLogPrecision()과 같은 기준
+    double meanPrecisionBits = 0;
+    bool alert               = false;
+    // histogram[b]: 정밀도가 (b, b+1] bit인 슬롯 수 (오차 2^-(b+1) 이상 2^-b 미만). 오차 1 이상은 0번, 오차 0은 마지막 칸
+    std::array<uint32_t, HISTOGRAM_BINS> histogram{};
+};
+
+// ------------------------------- PrecisionAnalyzer
+class PrecisionAnalyzer {
+public:
+    using AlertHandler = std::function<void(const PrecisionReport&)>;
+
+private:
+    double alertBits;
+    AlertHandler onAlert;
+    std::vector<PrecisionReport> reports;
+    std::vector<double> err2;  // 슬롯별 오차 제곱. 호출마다 재사용
+    mutable std::mutex mtx;
+
+    // floor(log2(err))를 err^2의 지수 비트에서 바로 계산 (sqrt, log2 호출 없음)
+    static size_t histogramBin(double e2) {
+        uint64_t bits;
+        std::memcpy(&bits, &e2, sizeof(bits));
+        const int64_t exponent = static_cast<int64_t>((bits >> 52) & 0x7ff) - 1023;  // floor(log2(err^2))
+        const int64_t bin      = -(exponent >> 1) - 1;                                // exponent >> 1 = floor(log2(err))
+        return static_cast<size_t>(
+            std::min<int64_t>(std::max<int64_t>(bin, 0), PrecisionReport::HISTOGRAM_BINS - 1));
+    }
+
+    static std::string escapeJson(const std::string& s) {
+        std::string out;
+        for (char c : s) {
+            if (c == '"' || c == '\\')
+                out += '\\';
+            out += c;
+        }
+        return out;
+    }
+
+    static std::string quoteCsv(const std::string& s) {
+        std::string out = "\"";
+        for (char c : s) {
+            if (c == '"')
+                out += '"';
+            out += c;
+        }
+        return out + "\"";
+    }
+
+    // 오차가 0이면 정밀도가 inf: JSON에는 null로 기록
+    static void writeJsonNumber(std::ostream& out, double value) {
+        if (std::isfinite(value))
+            out << value;
+        else
+            out << "null";
+    }
+
+public:
+    // alertBits: 이보다 정밀도(bit)가 낮으면 alert. 0이면 alert 없음
+    explicit PrecisionAnalyzer(double alertBits = 0) : alertBits(alertBits) {}
+
+    void setAlertThreshold(double bits) {
+        std::lock_guard<std::mutex> lock(mtx);
+        alertBits = bits;
+    }
+
+    double getAlertThreshold() const {
+        std::lock_guard<std::mutex> lock(mtx);
+        return alertBits;
+    }
+
+    // alert가 발생할 때마다 호출 (예: 예외를 던져 회로 중단, 로그 기록)
+    void setAlertHandler(AlertHandler handler) {
+        std::lock_guard<std::mutex> lock(mtx);
+        onAlert = std::move(handler);
+    }
+
+    PrecisionReport analyze(const std::string& label, const std::vector<std::complex<double>>& decrypted,
+                            const std::vector<std::complex<double>>& original) {
+        std::unique_lock<std::mutex> lock(mtx);
+        SquaredErrorKernel(err2, decrypted, original);
+
+        PrecisionReport report;
+        report.label = label;
+        report.slots = err2.size();
+        // 한 번의 순회에서 최대값, 합계, 히스토그램 계산. 슬롯 4개씩 누적 변수와 히스토그램을 따로 두어
+        // 같은 칸을 연속으로 갱신할 때의 메모리 의존성과 덧셈 지연을 숨김
+        const double* e = err2.data();
+        const size_t n  = err2.size();
+        double sum[4]   = {0, 0, 0, 0};
+        uint32_t bins[4][PrecisionReport::HISTOGRAM_BINS] = {};
+        double max2 = 0;
+        for (size_t i = 0; i < n; ++i) {
+            const double e2 = e[i];
+            sum[i & 3] += std::sqrt(e2);
+            bins[i & 3][histogramBin(e2)]++;
+            if (e2 > max2) {
+                max2                = e2;
+                report.maxErrorSlot = i;
+            }
+        }
+        for (size_t b = 0; b < PrecisionReport::HISTOGRAM_BINS; ++b)
+            report.histogram[b] = bins[0][b] + bins[1][b] + bins[2][b] + bins[3][b];
+        const double total = (sum[0] + sum[1]) + (sum[2] + sum[3]);
+
+        report.maxAbsError       = std::sqrt(max2);
+        report.meanAbsError      = report.slots ? total / report.slots : 0;
+        report.precisionBits     = -std::log2(report.maxAbsError);
+        report.meanPrecisionBits = -std::log2(report.meanAbsError);
+        report.alert             = alertBits > 0 && report.precisionBits < alertBits;
+        reports.push_back(report);
+
+        AlertHandler handler = report.alert ? onAlert : nullptr;
+        lock.unlock();
+        if (handler)
+            handler(report);
+        return report;
+    }
+
+    std::vector<PrecisionReport> getReports() const {
+        std::lock_guard<std::mutex> lock(mtx);
+        return reports;
+    }
+
+    size_t getAlertCount() const {
+        std::lock_guard<std::mutex> lock(mtx);
+        return std::count_if(reports.begin(), reports.end(), [](const PrecisionReport& r) { return r.alert; });
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> lock(mtx);
+        reports.clear();
+    }
+
+    // 보고서 배열. histogram은 0이 아닌 칸만 {"bits": b, "slots": n}으로
+    void exportJson(std::ostream& out) const {
+        std::lock_guard<std::mutex> lock(mtx);
+        out << std::setprecision(17) << "[";
+        for (size_t i = 0; i < reports.size(); ++i) {
+            const PrecisionReport& r = reports[i];
+            out << (i ? "," : "") << "\n{\"label\":\"" << escapeJson(r.label) << "\",\"slots\":" << r.slots
+                << ",\"maxAbsError\":" << r.maxAbsError << ",\"maxErrorSlot\":" << r.maxErrorSlot
+                << ",\"meanAbsError\":" << r.meanAbsError << ",\"precisionBits\":";
+            writeJsonNumber(out, r.precisionBits);
+            out << ",\"meanPrecisionBits\":";
+            writeJsonNumber(out, r.meanPrecisionBits);
+            out << ",\"alert\":" << (r.alert ? "true" : "false") << ",\"histogram\":[";
+            bool first = true;
+            for (size_t b = 0; b < r.histogram.size(); ++b) {
+                if (!r.histogram[b])
+                    continue;
+                out << (first ? "" : ",") << "{\"bits\":" << b << ",\"slots\":" << r.histogram[b] << "}";
+                first = false;
+            }
+            out << "]}";
+        }
+        out << "\n]\n";
+    }
+
+    void exportJson(const std::string& path) const {
+        std::ofstream out(path);
+        if (!out)
+            throw std::runtime_error("PrecisionAnalyzer: cannot open " + path);
+        exportJson(out);
+    }
+
+    // 한 줄에 보고서 하나. histogram 열은 bin 0..63
+    void exportCsv(std::ostream& out) const {
+        std::lock_guard<std::mutex> lock(mtx);
+        out << std::setprecision(17)
+            << "label,slots,maxAbsError,maxErrorSlot,meanAbsError,precisionBits,meanPrecisionBits,alert";
+        for (size_t b = 0; b < PrecisionReport::HISTOGRAM_BINS; ++b)
+            out << ",bin" << b;
+        out << "\n";
+        for (const PrecisionReport& r : reports) {
+            out << quoteCsv(r.label) << "," << r.slots << "," << r.maxAbsError << "," << r.maxErrorSlot << ","
+                << r.meanAbsError << "," << r.precisionBits << "," << r.meanPrecisionBits << "," << r.alert;
+            for (uint32_t count : r.histogram)
+                out << "," << count;
+            out << "\n";
+        }
+    }
+
+    void exportCsv(const std::string& path) const {
+        std::ofstream out(path);
+        if (!out)
+            throw std::runtime_error("PrecisionAnalyzer: cannot open " + path);
+        exportCsv(out);
+    }
+};
+
+}  // namespace lbcrypto
+
+#endif
@@ -0,0 +1,129 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Set of rotation steps used by a traced circuit
+  Used to generate only the Galois / rotation keys a circuit needs
+ */
+
+#ifndef LBCRYPTO_TRACE_ROTATION_STEPS_H
+#define LBCRYPTO_TRACE_ROTATION_STEPS_H
+
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace lbcrypto {
+
+// ------------------------------- RotationSteps
+class RotationSteps {
+private:
+    std::set<int32_t> steps;
+    mutable std::mutex mtx;
+
+public:
+    RotationSteps() = default;
+
+    RotationSteps(std::initializer_list<int32_t> init) : steps(init) {}
+
+    RotationSteps(const RotationSteps& other) : steps(other.get()) {}
+
+    RotationSteps& operator=(const RotationSteps& other) {
+        std::set<int32_t> copy = other.get();
+        std::lock_guard<std::mutex> lock(mtx);
+        steps.swap(copy);
+        return *this;
+    }
+
+    void add(int32_t step) {
+        std::lock_guard<std::mutex> lock(mtx);
+        steps.insert(step);
+    }
+
+    void merge(const RotationSteps& other) {
+        std::set<int32_t> copy = other.get();
+        std::lock_guard<std::mutex> lock(mtx);
+        steps.insert(copy.begin(), copy.end());
+    }
+
+    std::set<int32_t> get() const {
+        std::lock_guard<std::mutex> lock(mtx);
+        return steps;
+    }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(mtx);
+        return steps.size();
+    }
+
+    bool empty() const {
+        return size() == 0;
+    }
+
+    // OpenFHE EvalRotateKeyGen(sk, indices)
+    std::vector<int32_t> toIndices() const {
+        std::lock_guard<std::mutex> lock(mtx);
+        return std::vector<int32_t>(steps.begin(), steps.end());
+    }
+
+    // SEAL KeyGenerator::create_galois_keys(steps, keys)
+    std::vector<int> toSealSteps() const {
+        std::lock_guard<std::mutex> lock(mtx);
+        return std::vector<int>(steps.begin(), steps.end());
+    }
+
+    // 텍스트 파일: 한 줄에 step 하나
+    bool save(const std::string& path) const {
+        std::ofstream out(path);
+        if (!out)
+            return false;
+        for (int32_t step : get())
+            out << step << "\n";
+        return static_cast<bool>(out);
+    }
+
+    bool load(const std::string& path) {
+        std::ifstream in(path);
+        if (!in)
+            return false;
+        int32_t step;
+        while (in >> step)
+            add(step);
+        return true;
+    }
+};
+
+}  // namespace lbcrypto
+
+#endif
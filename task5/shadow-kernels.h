@@ -0,0 +1,117 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Shadow (original vector) arithmetic kernels for TraceableCiphertext
+ */
+
+#ifndef LBCRYPTO_TRACE_SHADOW_KERNELS_H
+#define LBCRYPTO_TRACE_SHADOW_KERNELS_H
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <vector>
+
+namespace lbcrypto {
+
+// std::complex<double> 배열은 {re, im} double 배열과 메모리 배치가 같음이 보장됨.
+// double 배열로 풀어서 계산하면 컴파일러가 SIMD로 벡터화할 수 있음 (std::complex 곱셈은 NaN 처리 때문에 벡터화되지 않음)
+
+// dst[i] += src[i]
+inline void ShadowAddInPlace(std::vector<std::complex<double>>& dst, const std::vector<std::complex<double>>& src) {
+    const size_t n = 2 * std::min(dst.size(), src.size());
+    double* d       = reinterpret_cast<double*>(dst.data());
+    const double* s = reinterpret_cast<const double*>(src.data());
+    for (size_t i = 0; i < n; ++i) {
+        d[i] += s[i];
+    }
+}
+
+// dst[i] += constant (실수부만)
+inline void ShadowAddInPlace(std::vector<std::complex<double>>& dst, double constant) {
+    const size_t n = 2 * dst.size();
+    double* d      = reinterpret_cast<double*>(dst.data());
+    for (size_t i = 0; i < n; i += 2) {
+        d[i] += constant;
+    }
+}
+
+// dst[i] *= src[i] (복소수 곱). dst와 src가 같은 벡터여도 원소 단위로 안전
+inline void ShadowMultInPlace(std::vector<std::complex<double>>& dst, const std::vector<std::complex<double>>& src) {
+    const size_t n  = std::min(dst.size(), src.size());
+    double* d       = reinterpret_cast<double*>(dst.data());
+    const double* s = reinterpret_cast<const double*>(src.data());
+    for (size_t i = 0; i < n; ++i) {
+        const double ar = d[2 * i], ai = d[2 * i + 1];
+        const double br = s[2 * i], bi = s[2 * i + 1];
+        d[2 * i]        = ar * br - ai * bi;
+        d[2 * i + 1]    = ar * bi + ai * br;
+    }
+}
+
+// dst[i] *= constant
+inline void ShadowMultInPlace(std::vector<std::complex<double>>& dst, double constant) {
+    const size_t n = 2 * dst.size();
+    double* d      = reinterpret_cast<double*>(dst.data());
+    for (size_t i = 0; i < n; ++i) {
+        d[i] *= constant;
+    }
+}
+
+// dst[i] += weight * src[i]
+inline void ShadowAxpyInPlace(std::vector<std::complex<double>>& dst, const std::vector<std::complex<double>>& src,
+                              double weight) {
+    const size_t n  = 2 * std::min(dst.size(), src.size());
+    double* d       = reinterpret_cast<double*>(dst.data());
+    const double* s = reinterpret_cast<const double*>(src.data());
+    for (size_t i = 0; i < n; ++i) {
+        d[i] += weight * s[i];
+    }
+}
+
+// dst[i] = src[(i + index) mod slots]: 왼쪽 회전 (index < 0이면 오른쪽). src 길이를 넘는 슬롯은 0으로 간주
+inline void ShadowRotate(std::vector<std::complex<double>>& dst, const std::vector<std::complex<double>>& src,
+                         int32_t index, size_t slots) {
+    dst.resize(src.size());
+    if (slots == 0)
+        return;
+    const int64_t n     = static_cast<int64_t>(slots);
+    const int64_t shift = ((static_cast<int64_t>(index) % n) + n) % n;
+    for (size_t i = 0; i < src.size(); ++i) {
+        const size_t j = static_cast<size_t>((static_cast<int64_t>(i) + shift) % n);
+        dst[i]         = j < src.size() ? src[j] : std::complex<double>(0);
+    }
+}
+
+}  // namespace lbcrypto
+
+#endif
@@ -0,0 +1,135 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Multi-tenant slot packing layout
+  슬롯을 크기 blockSize인 block으로 나누고, 독립적인 작은 벡터(tenant) 하나를 block 하나에 넣음
+  - 원소별 연산(덧셈, 곱셈, 다항식)은 block끼리 섞이지 않으므로 한 번 평가로 모든 tenant의 결과를 얻음
+  - 회전은 block 경계를 넘어 이웃 tenant의 값을 가져오므로 blockMask()로 만든 mask로 잘라냄 (openfhe-slot-packing.h)
+  - tenant 벡터가 blockSize보다 짧으면 나머지 슬롯은 0
+ */
+
+#ifndef LBCRYPTO_TRACE_SLOT_PACKER_H
+#define LBCRYPTO_TRACE_SLOT_PACKER_H
+
+#include <algorithm>
+#include <complex>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace lbcrypto {
+
+// ------------------------------- SlotPacker
+class SlotPacker {
+private:
+    size_t slots;
+    size_t blockSize;
+
+public:
+    // slots: 암호문의 슬롯 수 (batch size), blockSize: tenant 하나가 차지하는 슬롯 수 (slots의 약수)
+    SlotPacker(size_t slots, size_t blockSize) : slots(slots), blockSize(blockSize) {
+        if (blockSize == 0 || slots % blockSize != 0)
+            throw std::invalid_argument("SlotPacker: block size must divide the slot count");
+    }
+
+    size_t getSlots() const {
+        return slots;
+    }
+
+    size_t getBlockSize() const {
+        return blockSize;
+    }
+
+    // 암호문 하나에 넣을 수 있는 tenant 수
+    size_t capacity() const {
+        return slots / blockSize;
+    }
+
+    // tenant t의 값은 슬롯 [t * blockSize, t * blockSize + 길이)에 들어감
+    template <typename T>
+    std::vector<T> pack(const std::vector<std::vector<T>>& tenants) const {
+        if (tenants.size() > capacity())
+            throw std::invalid_argument("SlotPacker: " + std::to_string(tenants.size()) + " tenants exceed capacity " +
+                                        std::to_string(capacity()));
+        std::vector<T> packed(slots, T(0));
+        for (size_t t = 0; t < tenants.size(); ++t) {
+            if (tenants[t].size() > blockSize)
+                throw std::invalid_argument("SlotPacker: tenant " + std::to_string(t) + " is longer than the block");
+            std::copy(tenants[t].begin(), tenants[t].end(), packed.begin() + t * blockSize);
+        }
+        return packed;
+    }
+
+    // lengths[t]: tenant t의 원래 길이. 복호화한 슬롯에서 tenant별 결과를 꺼냄
+    template <typename T>
+    std::vector<std::vector<T>> unpack(const std::vector<T>& packed, const std::vector<size_t>& lengths) const {
+        if (lengths.size() > capacity() || packed.size() < lengths.size() * blockSize)
+            throw std::invalid_argument("SlotPacker: packed vector does not hold all tenants");
+        std::vector<std::vector<T>> tenants(lengths.size());
+        for (size_t t = 0; t < lengths.size(); ++t) {
+            auto begin = packed.begin() + t * blockSize;
+            tenants[t].assign(begin, begin + std::min(lengths[t], blockSize));
+        }
+        return tenants;
+    }
+
+    // 모든 block에서 위치 [begin, end)는 1, 나머지는 0
+    std::vector<double> blockMask(size_t begin, size_t end) const {
+        std::vector<double> mask(slots, 0.0);
+        for (size_t b = 0; b < slots; b += blockSize) {
+            for (size_t j = begin; j < end && j < blockSize; ++j)
+                mask[b + j] = 1.0;
+        }
+        return mask;
+    }
+
+    // block 안에서의 왼쪽 회전 k를 [0, blockSize)로 정규화
+    size_t normalizeStep(int32_t k) const {
+        const int64_t n = static_cast<int64_t>(blockSize);
+        return static_cast<size_t>(((static_cast<int64_t>(k) % n) + n) % n);
+    }
+
+    // block 안 회전 k에 필요한 전체 슬롯 회전 index: k와 k - blockSize (k가 0이면 없음, block이 하나면 k만)
+    std::vector<int32_t> rotationIndices(int32_t k) const {
+        const size_t step = normalizeStep(k);
+        if (step == 0)
+            return {};
+        if (blockSize == slots)
+            return {static_cast<int32_t>(step)};
+        return {static_cast<int32_t>(step), static_cast<int32_t>(step) - static_cast<int32_t>(blockSize)};
+    }
+};
+
+}  // namespace lbcrypto
+
+#endif
@@ -0,0 +1,185 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Streaming CKKS evaluation
+  파일(또는 stdin)에서 한 줄에 하나씩 실수를 읽어 slot 수만큼 묶고,
+  encode → encrypt → (x+1)^2(x^2+2) → decrypt/decode 단계를 BoundedQueue로 연결해 동시에 실행
+  결과는 입력 순서대로 한 줄에 하나씩 출력. 큐 크기가 고정이라 메모리 사용량은 입력 크기와 무관
+ */
+
+#include "openfhe.h"
+#include "stream-pipeline.h"
+
+#include <fstream>
+#include <map>
+
+using namespace lbcrypto;
+
+struct Batch {
+    uint64_t seq = 0;
+    size_t count = 0;   // 실제 레코드 수 (마지막 batch는 slot 수보다 적을 수 있음)
+    std::vector<double> values;
+    Plaintext ptxt;
+    Ciphertext<DCRTPoly> ctxt;
+};
+
+// 사용법: stream-eval [input.txt | -] [--output out.txt] [--eval-workers 2] [--queue 4]
+int main(int argc, char* argv[]) {
+    std::string inputPath = "-", outputPath;
+    size_t evalWorkers = 2, queueSize = 4;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--output" && i + 1 < argc)
+            outputPath = argv[++i];
+        else if (arg == "--eval-workers" && i + 1 < argc)
+            evalWorkers = std::stoul(argv[++i]);
+        else if (arg == "--queue" && i + 1 < argc)
+            queueSize = std::stoul(argv[++i]);
+        else
+            inputPath = arg;
+    }
+
+    CCParams<CryptoContextCKKSRNS> parameters;
+    parameters.SetMultiplicativeDepth(2);
+    parameters.SetScalingModSize(50);
+    parameters.SetScalingTechnique(FLEXIBLEAUTO);
+
+    CryptoContext<DCRTPoly> cc = GenCryptoContext(parameters);
+    cc->Enable(PKE);
+    cc->Enable(KEYSWITCH);
+    cc->Enable(LEVELEDSHE);
+
+    auto keys = cc->KeyGen();
+    cc->EvalMultKeyGen(keys.secretKey);
+    const size_t slots = cc->GetRingDimension() / 2;
+    std::cerr << "CKKS scheme is using ring dimension " << cc->GetRingDimension() << ", " << slots
+              << " records per ciphertext" << std::endl;
+
+    std::ifstream file;
+    if (inputPath != "-") {
+        file.open(inputPath);
+        if (!file) {
+            std::cerr << "cannot open " << inputPath << std::endl;
+            return 1;
+        }
+    }
+    std::istream& in = inputPath == "-" ? std::cin : file;
+    std::ofstream outFile;
+    if (!outputPath.empty())
+        outFile.open(outputPath);
+    std::ostream& out = outputPath.empty() ? std::cout : outFile;
+
+    BoundedQueue<Batch> read(queueSize), encoded(queueSize), encrypted(queueSize), evaluated(queueSize),
+        decoded(queueSize);
+    auto start = std::chrono::steady_clock::now();
+
+    std::thread reader([&] {
+        uint64_t seq = 0;
+        double v;
+        Batch batch;
+        while (in >> v) {
+            if (batch.values.empty())
+                batch.values.reserve(slots);
+            batch.values.push_back(v);
+            if (batch.values.size() == slots) {
+                batch.seq   = seq++;
+                batch.count = slots;
+                read.push(std::move(batch));
+                batch = Batch();
+            }
+        }
+        if (!batch.values.empty()) {
+            batch.seq   = seq;
+            batch.count = batch.values.size();
+            batch.values.resize(slots, 0.0);
+            read.push(std::move(batch));
+        }
+        read.close();
+    });
+
+    std::vector<StageStats> stats;
+    {
+        PipelineStage<Batch> encode("encode", 1, read, encoded, [&](Batch& b) {
+            b.ptxt = cc->MakeCKKSPackedPlaintext(b.values);
+            b.values.clear();
+            b.values.shrink_to_fit();
+        });
+        PipelineStage<Batch> encrypt("encrypt", 1, encoded, encrypted, [&](Batch& b) {
+            b.ctxt = cc->Encrypt(keys.publicKey, b.ptxt);
+            b.ptxt = nullptr;
+        });
+        PipelineStage<Batch> evaluate("evaluate", evalWorkers, encrypted, evaluated, [&](Batch& b) {
+            auto c1 = cc->EvalAdd(b.ctxt, 1.0);
+            auto c2 = cc->EvalAdd(cc->EvalSquare(b.ctxt), 2.0);
+            b.ctxt  = cc->EvalMult(cc->EvalSquare(c1), c2);
+        });
+        PipelineStage<Batch> decrypt("decrypt", 1, evaluated, decoded, [&](Batch& b) {
+            Plaintext result;
+            cc->Decrypt(keys.secretKey, b.ctxt, &result);
+            result->SetLength(b.count);
+            const auto& packed = result->GetCKKSPackedValue();
+            b.values.resize(b.count);
+            for (size_t i = 0; i < b.count; ++i)
+                b.values[i] = packed[i].real();
+            b.ctxt = nullptr;
+        });
+
+        // evaluate 단계가 여러 worker면 순서가 바뀔 수 있으므로 seq 순서대로 출력
+        // (대기 중인 batch 수는 큐 크기와 worker 수로 제한됨)
+        std::map<uint64_t, Batch> reorder;
+        uint64_t next = 0;
+        size_t records = 0;
+        Batch b;
+        while (decoded.pop(b)) {
+            reorder.emplace(b.seq, std::move(b));
+            for (auto it = reorder.begin(); it != reorder.end() && it->first == next; it = reorder.erase(it), ++next) {
+                for (double v : it->second.values)
+                    out << v << "\n";
+                records += it->second.count;
+            }
+        }
+        out.flush();
+
+        reader.join();
+        encode.join();
+        encrypt.join();
+        evaluate.join();
+        decrypt.join();
+        stats = {encode.getStats(), encrypt.getStats(), evaluate.getStats(), decrypt.getStats()};
+
+        double wallMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        std::cerr << records << " records in " << wallMs << " ms (" << records / (wallMs / 1000) << " records/s)"
+                  << std::endl;
+        printStageStats(stats, wallMs);
+    }
+    return 0;
+}
@@ -0,0 +1,191 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Streaming pipeline building blocks
+  BoundedQueue: 가득 차면 push가 기다림(backpressure) → 파이프라인 전체 메모리가 입력 크기와 무관하게 일정
+  PipelineStage: 입력 큐에서 꺼내 처리한 뒤 출력 큐에 넣는 worker 스레드 묶음. 처리 시간과 대기 시간을 따로 기록
+ */
+
+#ifndef LBCRYPTO_TRACE_STREAM_PIPELINE_H
+#define LBCRYPTO_TRACE_STREAM_PIPELINE_H
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace lbcrypto {
+
+template <typename T>
+class BoundedQueue {
+private:
+    std::deque<T> items;
+    size_t capacity;
+    bool closed = false;
+    std::mutex mtx;
+    std::condition_variable notFull;
+    std::condition_variable notEmpty;
+
+public:
+    explicit BoundedQueue(size_t capacity) : capacity(std::max<size_t>(capacity, 1)) {}
+
+    // 닫힌 큐에 넣으면 false
+    bool push(T item) {
+        std::unique_lock<std::mutex> lock(mtx);
+        notFull.wait(lock, [this] { return closed || items.size() < capacity; });
+        if (closed)
+            return false;
+        items.push_back(std::move(item));
+        notEmpty.notify_one();
+        return true;
+    }
+
+    // 닫히고 비었으면 false
+    bool pop(T& item) {
+        std::unique_lock<std::mutex> lock(mtx);
+        notEmpty.wait(lock, [this] { return closed || !items.empty(); });
+        if (items.empty())
+            return false;
+        item = std::move(items.front());
+        items.pop_front();
+        notFull.notify_one();
+        return true;
+    }
+
+    // 더 이상 push하지 않음. 남은 항목은 pop으로 꺼낼 수 있음
+    void close() {
+        std::lock_guard<std::mutex> lock(mtx);
+        closed = true;
+        notFull.notify_all();
+        notEmpty.notify_all();
+    }
+};
+
+struct StageStats {
+    std::string name;
+    size_t workers = 0;
+    size_t items   = 0;
+    double busyMs  = 0;   // 처리 시간 (모든 worker 합)
+    double waitMs  = 0;   // 입력을 기다리거나 출력 큐가 빌 때까지 기다린 시간
+};
+
+template <typename T>
+class PipelineStage {
+private:
+    using Clock = std::chrono::steady_clock;
+
+    StageStats stats;
+    std::mutex statsMtx;
+    std::atomic<size_t> running;
+    std::vector<std::thread> threads;
+
+    static double ms(Clock::time_point a, Clock::time_point b) {
+        return std::chrono::duration<double, std::milli>(b - a).count();
+    }
+
+public:
+    // fn이 처리한 항목을 out에 넣음. 마지막 worker가 끝나면 out을 닫음
+    PipelineStage(const std::string& name, size_t workers, BoundedQueue<T>& in, BoundedQueue<T>& out,
+                  std::function<void(T&)> fn)
+        : running(std::max<size_t>(workers, 1)) {
+        stats.name    = name;
+        stats.workers = running;
+        for (size_t w = 0; w < stats.workers; ++w) {
+            threads.emplace_back([this, &in, &out, fn] {
+                double busy = 0, wait = 0;
+                size_t count = 0;
+                T item;
+                auto t0 = Clock::now();
+                while (in.pop(item)) {
+                    auto t1 = Clock::now();
+                    fn(item);
+                    auto t2 = Clock::now();
+                    out.push(std::move(item));
+                    auto t3 = Clock::now();
+                    wait += ms(t0, t1) + ms(t2, t3);
+                    busy += ms(t1, t2);
+                    count++;
+                    t0 = t3;
+                }
+                {
+                    std::lock_guard<std::mutex> lock(statsMtx);
+                    stats.busyMs += busy;
+                    stats.waitMs += wait;
+                    stats.items += count;
+                }
+                if (--running == 0)
+                    out.close();
+            });
+        }
+    }
+
+    ~PipelineStage() {
+        join();
+    }
+
+    PipelineStage(const PipelineStage&)            = delete;
+    PipelineStage& operator=(const PipelineStage&) = delete;
+
+    void join() {
+        for (auto& t : threads)
+            if (t.joinable())
+                t.join();
+    }
+
+    // join() 이후에 호출
+    const StageStats& getStats() const {
+        return stats;
+    }
+};
+
+// 단계별 처리량과 활용률(처리 시간 / (전체 시간 × worker 수))
+inline void printStageStats(const std::vector<StageStats>& stages, double wallMs, std::ostream& os = std::cerr) {
+    os << std::setw(10) << "stage" << std::setw(9) << "workers" << std::setw(9) << "items" << std::setw(12)
+       << "busy(ms)" << std::setw(12) << "wait(ms)" << std::setw(8) << "util" << std::endl;
+    for (const auto& s : stages) {
+        os << std::setw(10) << s.name << std::setw(9) << s.workers << std::setw(9) << s.items << std::fixed
+           << std::setprecision(1) << std::setw(12) << s.busyMs << std::setw(12) << s.waitMs << std::setw(7)
+           << (wallMs > 0 ? 100 * s.busyMs / (wallMs * s.workers) : 0) << "%" << std::defaultfloat << std::endl;
+    }
+}
+
+}  // namespace lbcrypto
+
+#endif
@@ -0,0 +1,59 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Verification policy shared by TraceableCiphertext and TracedCiphertext
+ */
+
+#ifndef LBCRYPTO_TRACE_POLICY_H
+#define LBCRYPTO_TRACE_POLICY_H
+
+#include <cstdint>
+
+namespace lbcrypto {
+
+// ------------------------------- TracePolicy
+enum TraceMode {
+    TRACE_OFF,          // 검증하지 않음
+    TRACE_EVERY_NTH,    // N번째 연산마다 검증
+    TRACE_CHECKPOINT,   // checkpoint()로 지정한 지점에서만 검증
+    TRACE_AT_END        // finish() 호출 시 마지막 결과만 한 번 검증
+};
+
+struct TracePolicy {
+    TraceMode mode   = TRACE_EVERY_NTH;
+    uint32_t interval = 1;      // TRACE_EVERY_NTH일 때의 N. 기본값(매 연산 검증)은 기존 동작과 같음
+    bool deferred    = false;   // true면 검증을 큐에 쌓아 두었다가 flushTrace()에서 한꺼번에 수행
+};
+
+}  // namespace lbcrypto
+
+#endif
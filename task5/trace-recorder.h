@@ -0,0 +1,312 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Computation-DAG recorder for TraceableCiphertext
+  Exports the recorded circuit to Chrome trace / Perfetto JSON and to a compact binary log
+ */
+
+#ifndef LBCRYPTO_TRACE_RECORDER_H
+#define LBCRYPTO_TRACE_RECORDER_H
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace lbcrypto {
+
+// DAG의 노드 하나 = 연산 하나. 피연산자 노드 id를 간선으로 가짐
+struct TraceNode {
+    uint64_t id = 0;
+    std::string op;
+    std::vector<uint64_t> operands;
+    uint32_t level          = 0;    // GetLevel()
+    uint32_t noiseScaleDeg  = 0;    // GetNoiseScaleDeg()
+    double scalingFactor    = 0;    // GetScalingFactor()
+    double startUs          = 0;    // recorder 생성 시점 기준 시작 시각
+    double latencyUs        = 0;    // 연산 소요 시간(wall-clock)
+    uint64_t bytes          = 0;    // 결과 암호문 크기
+    double constant         = 0;    // 상수 연산(cipherAdd(const), cipherMult(const))의 상수, cipherLinearWSum의 더하는 상수
+    std::vector<double> weights;    // cipherLinearWSum의 피연산자별 가중치
+};
+
+// ------------------------------- TraceRecorder
+class TraceRecorder {
+private:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr uint32_t BINARY_MAGIC   = 0x52544b43;  // "CKTR"
+    static constexpr uint32_t BINARY_VERSION = 3;   // 2: constant 필드 추가, 3: weights 필드 추가
+
+    Clock::time_point origin;
+    std::vector<TraceNode> nodes;
+    mutable std::mutex mtx;
+
+    template <typename T>
+    static void writeRaw(std::ostream& out, const T& value) {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+    }
+
+    template <typename T>
+    static T readRaw(std::istream& in) {
+        T value;
+        if (!in.read(reinterpret_cast<char*>(&value), sizeof(T)))
+            throw std::runtime_error("TraceRecorder: truncated binary log");
+        return value;
+    }
+
+    static std::string escapeJson(const std::string& s) {
+        std::string out;
+        for (char c : s) {
+            if (c == '"' || c == '\\')
+                out += '\\';
+            out += c;
+        }
+        return out;
+    }
+
+public:
+    TraceRecorder() : origin(Clock::now()) {}
+
+    double nowUs() const {
+        return std::chrono::duration<double, std::micro>(Clock::now() - origin).count();
+    }
+
+    double toUs(Clock::time_point t) const {
+        return std::chrono::duration<double, std::micro>(t - origin).count();
+    }
+
+    uint64_t addNode(TraceNode node) {  // id를 부여하고 저장. 부여된 id(1부터) 반환
+        std::lock_guard<std::mutex> lock(mtx);
+        node.id = nodes.size() + 1;
+        nodes.push_back(std::move(node));
+        return nodes.back().id;
+    }
+
+    std::vector<TraceNode> getNodes() const {
+        std::lock_guard<std::mutex> lock(mtx);
+        return nodes;
+    }
+
+    size_t size() const {
+        std::lock_guard<std::mutex> lock(mtx);
+        return nodes.size();
+    }
+
+    void clear() {
+        std::lock_guard<std::mutex> lock(mtx);
+        nodes.clear();
+        origin = Clock::now();
+    }
+
+    // chrome://tracing, ui.perfetto.dev에서 열 수 있는 JSON. 연산은 "X" 이벤트, 간선은 flow("s"/"f") 이벤트
+    void exportChromeTrace(std::ostream& out) const {
+        std::lock_guard<std::mutex> lock(mtx);
+        out << std::setprecision(17);
+        out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        bool first = true;
+        auto sep   = [&]() {
+            if (!first)
+                out << ",";
+            first = false;
+            out << "\n";
+        };
+        for (const auto& n : nodes) {
+            sep();
+            out << "{\"name\":\"" << escapeJson(n.op) << "\",\"cat\":\"ckks\",\"ph\":\"X\",\"pid\":1,\"tid\":1"
+                << ",\"ts\":" << n.startUs << ",\"dur\":" << n.latencyUs << ",\"args\":{\"id\":" << n.id
+                << ",\"operands\":[";
+            for (size_t i = 0; i < n.operands.size(); ++i)
+                out << (i ? "," : "") << n.operands[i];
+            out << "],\"level\":" << n.level << ",\"noiseScaleDeg\":" << n.noiseScaleDeg
+                << ",\"scalingFactor\":" << n.scalingFactor << ",\"bytes\":" << n.bytes << ",\"constant\":" << n.constant;
+            if (!n.weights.empty()) {
+                out << ",\"weights\":[";
+                for (size_t i = 0; i < n.weights.size(); ++i)
+                    out << (i ? "," : "") << n.weights[i];
+                out << "]";
+            }
+            out << "}}";
+        }
+        uint64_t flowId = 0;
+        for (const auto& n : nodes) {
+            for (uint64_t operand : n.operands) {
+                if (operand == 0 || operand > nodes.size())
+                    continue;
+                const TraceNode& src = nodes[operand - 1];
+                ++flowId;
+                sep();
+                out << "{\"name\":\"dep\",\"cat\":\"dag\",\"ph\":\"s\",\"pid\":1,\"tid\":1,\"id\":" << flowId
+                    << ",\"ts\":" << src.startUs + src.latencyUs << "}";
+                sep();
+                out << "{\"name\":\"dep\",\"cat\":\"dag\",\"ph\":\"f\",\"bp\":\"e\",\"pid\":1,\"tid\":1,\"id\":" << flowId
+                    << ",\"ts\":" << n.startUs << "}";
+            }
+        }
+        out << "\n]}\n";
+    }
+
+    void exportChromeTrace(const std::string& path) const {
+        std::ofstream out(path);
+        if (!out)
+            throw std::runtime_error("TraceRecorder: cannot open " + path);
+        exportChromeTrace(out);
+    }
+
+    // 바이너리 로그: magic, version, 연산 이름 테이블, 노드 레코드(고정 필드 + 피연산자 목록). 호스트 엔디언
+    void exportBinary(std::ostream& out) const {
+        std::lock_guard<std::mutex> lock(mtx);
+        std::map<std::string, uint16_t> opIndex;
+        std::vector<const std::string*> opNames;
+        for (const auto& n : nodes) {
+            if (opIndex.emplace(n.op, static_cast<uint16_t>(opNames.size())).second)
+                opNames.push_back(&n.op);
+        }
+        writeRaw(out, BINARY_MAGIC);
+        writeRaw(out, BINARY_VERSION);
+        writeRaw(out, static_cast<uint16_t>(opNames.size()));
+        for (const std::string* name : opNames) {
+            writeRaw(out, static_cast<uint16_t>(name->size()));
+            out.write(name->data(), name->size());
+        }
+        writeRaw(out, static_cast<uint64_t>(nodes.size()));
+        for (const auto& n : nodes) {
+            if (n.operands.size() > UINT8_MAX)
+                throw std::runtime_error("TraceRecorder: too many operands for binary log (" + n.op + ")");
+            writeRaw(out, opIndex[n.op]);
+            writeRaw(out, static_cast<uint8_t>(n.operands.size()));
+            for (uint64_t operand : n.operands)
+                writeRaw(out, operand);
+            writeRaw(out, n.level);
+            writeRaw(out, n.noiseScaleDeg);
+            writeRaw(out, n.scalingFactor);
+            writeRaw(out, n.startUs);
+            writeRaw(out, n.latencyUs);
+            writeRaw(out, n.bytes);
+            writeRaw(out, n.constant);
+            writeRaw(out, static_cast<uint8_t>(n.weights.size()));
+            for (double weight : n.weights)
+                writeRaw(out, weight);
+        }
+    }
+
+    void exportBinary(const std::string& path) const {
+        std::ofstream out(path, std::ios::binary);
+        if (!out)
+            throw std::runtime_error("TraceRecorder: cannot open " + path);
+        exportBinary(out);
+    }
+
+    static std::vector<TraceNode> loadBinary(std::istream& in) {
+        if (readRaw<uint32_t>(in) != BINARY_MAGIC)
+            throw std::runtime_error("TraceRecorder: not a trace log");
+        const uint32_t version = readRaw<uint32_t>(in);
+        if (version < 1 || version > BINARY_VERSION)
+            throw std::runtime_error("TraceRecorder: unsupported trace log version");
+        std::vector<std::string> opNames(readRaw<uint16_t>(in));
+        for (auto& name : opNames) {
+            name.resize(readRaw<uint16_t>(in));
+            in.read(&name[0], name.size());
+        }
+        std::vector<TraceNode> result(readRaw<uint64_t>(in));
+        for (size_t i = 0; i < result.size(); ++i) {
+            TraceNode& n = result[i];
+            n.id         = i + 1;
+            n.op         = opNames.at(readRaw<uint16_t>(in));
+            n.operands.resize(readRaw<uint8_t>(in));
+            for (auto& operand : n.operands)
+                operand = readRaw<uint64_t>(in);
+            n.level         = readRaw<uint32_t>(in);
+            n.noiseScaleDeg = readRaw<uint32_t>(in);
+            n.scalingFactor = readRaw<double>(in);
+            n.startUs       = readRaw<double>(in);
+            n.latencyUs     = readRaw<double>(in);
+            n.bytes         = readRaw<uint64_t>(in);
+            if (version >= 2)
+                n.constant = readRaw<double>(in);
+            if (version >= 3) {
+                n.weights.resize(readRaw<uint8_t>(in));
+                for (auto& weight : n.weights)
+                    weight = readRaw<double>(in);
+            }
+        }
+        return result;
+    }
+
+    // 연산 종류별 누적 시간과 비율, 레벨을 소모한 노드 목록
+    void printSummary(std::ostream& out = std::cout) const {
+        std::lock_guard<std::mutex> lock(mtx);
+        struct OpStat {
+            size_t count    = 0;
+            double totalUs  = 0;
+        };
+        std::map<std::string, OpStat> stats;
+        double totalUs = 0;
+        for (const auto& n : nodes) {
+            stats[n.op].count++;
+            stats[n.op].totalUs += n.latencyUs;
+            totalUs += n.latencyUs;
+        }
+        std::vector<std::pair<std::string, OpStat>> sorted(stats.begin(), stats.end());
+        std::sort(sorted.begin(), sorted.end(),
+                  [](const auto& a, const auto& b) { return a.second.totalUs > b.second.totalUs; });
+
+        out << "=== Trace summary: " << nodes.size() << " ops, " << totalUs / 1000 << " ms ===" << std::endl;
+        for (const auto& s : sorted) {
+            out << "  " << std::left << std::setw(20) << s.first << std::right << std::setw(4) << s.second.count
+                << " ops " << std::setw(12) << s.second.totalUs / 1000 << " ms " << std::setw(7)
+                << (totalUs > 0 ? 100 * s.second.totalUs / totalUs : 0) << " %" << std::endl;
+        }
+        out << "  Levels consumed:" << std::endl;
+        for (const auto& n : nodes) {
+            uint32_t inputLevel = 0;
+            for (uint64_t operand : n.operands) {
+                if (operand > 0 && operand <= nodes.size())
+                    inputLevel = std::max(inputLevel, nodes[operand - 1].level);
+            }
+            if (!n.operands.empty() && n.level > inputLevel) {
+                out << "    #" << n.id << " " << n.op << ": level " << inputLevel << " -> " << n.level << std::endl;
+            }
+        }
+    }
+};
+
+}  // namespace lbcrypto
+
+#endif
@@ -37,47 +37,166 @@
 #define PROFILE
 
 #include "openfhe.h"
+#include "key-snapshot.h"
+#include "param-tuner.h"
+#include "traceable-ciphertext.h"
+#include "async-ciphertext.h"
 
 using namespace lbcrypto;
 
 int main(int argc, char* argv[]) {
+    auto programStart = std::chrono::steady_clock::now();
 
     ScalingTechnique scalTech = FLEXIBLEAUTO;
     uint32_t batchSize = 8;
-    CCParams<CryptoContextCKKSRNS> parameters;
-    parameters.SetMultiplicativeDepth(5);
-    parameters.SetScalingModSize(50);
-    parameters.SetScalingTechnique(scalTech);
-    parameters.SetBatchSize(batchSize);
 
-    CryptoContext<DCRTPoly> cc = GenCryptoContext(parameters);
+    // 이전 실행에서 회로가 사용한 회전 index만 rotation key로 생성 (파일이 없으면 left rotation 2)
+    RotationSteps rotationSteps;
+    if (!rotationSteps.load("rotation-steps.txt"))
+        rotationSteps.add(2);
 
-    std::cout << "CKKS scheme is using ring dimension " << cc->GetRingDimension() << std::endl << std::endl;
+    // param-tune이 저장한 파라미터가 있으면 사용 (없으면 depth 5, scaling mod size 50)
+    CKKSParams tuned;
+    bool useTuned = tuned.load("ckks-params.cfg") && tuned.batchSize == batchSize;
 
-    cc->Enable(PKE);
-    cc->Enable(KEYSWITCH);
-    cc->Enable(LEVELEDSHE);
+    // 파라미터와 rotation index가 같으면 저장해 둔 CryptoContext와 키를 불러옴 (KeyGen 생략)
+    std::string snapshotTag = useTuned ? tuned.tag() + "-rot" : "depth5-scale50-FLEXIBLEAUTO-batch8-rot";
+    for (int32_t step : rotationSteps.get())
+        snapshotTag += " " + std::to_string(step);
+    KeySnapshot<DCRTPoly> snapshot("traceable-cipher-test.keys", snapshotTag);
 
-    auto keys = cc->KeyGen();
-    cc->EvalMultKeyGen(keys.secretKey);
+    CryptoContext<DCRTPoly> cc;
+    KeyPair<DCRTPoly> keys;
+    bool fromSnapshot = snapshot.load(cc, keys);
+    if (!fromSnapshot) {
+        CCParams<CryptoContextCKKSRNS> parameters;
+        if (useTuned) {
+            tuned.apply(parameters);
+        }
+        else {
+            parameters.SetMultiplicativeDepth(5);
+            parameters.SetScalingModSize(50);
+            parameters.SetScalingTechnique(scalTech);
+            parameters.SetBatchSize(batchSize);
+        }
+
+        cc = GenCryptoContext(parameters);
+
+        cc->Enable(PKE);
+        cc->Enable(KEYSWITCH);
+        cc->Enable(LEVELEDSHE);
+
+        keys = cc->KeyGen();
+        cc->EvalMultKeyGen(keys.secretKey);
+        cc->EvalRotateKeyGen(keys.secretKey, rotationSteps.toIndices());
+        snapshot.save(cc, keys);
+    }
+
+    std::cout << "CKKS scheme is using ring dimension " << cc->GetRingDimension()
+              << (useTuned ? " (parameters from ckks-params.cfg)" : "") << std::endl;
+    std::cout << (fromSnapshot ? "Keys loaded from " : "Keys generated and saved to ") << snapshot.getDir()
+              << std::endl << std::endl;
 
     // Input
     std::vector<std::complex<double>> x = {1.0, 1.01, 1.02, 1.03, 1.04, 1.05, 1.06, 1.07};
     Plaintext ptxt        = cc->MakeCKKSPackedPlaintext(x);
 
     auto c = cc->Encrypt(ptxt, keys.publicKey);          // x
-    TraceableCiphertext tc(x, c, keys.secretKey, cc);   // x
+    // 추적 정책: 기본값은 매 연산 검증. 예) {TRACE_EVERY_NTH, 3, true}: 3번째 연산마다 검증을 큐에 쌓았다가 finish()에서 한꺼번에 수행
+    TracePolicy policy;
+    double alertBits = -1;  // --precision <bits>: 출력 대신 모든 슬롯의 오차 보고서를 JSON으로 저장
+    bool useMemo     = false;   // --memo: 같은 (연산, 피연산자, 상수)의 결과 재사용
+    bool useAsync    = false;   // --async: 같은 회로를 AsyncTraceCircuit으로 한 번 더 실행해서 latency 비교
+    for (int i = 1; i < argc; ++i) {     // 실행 인자: off | every <N> | checkpoint | end, [--precision <bits>] [--memo] [--async]
+        std::string arg = argv[i];
+        if (arg == "--precision" && i + 1 < argc) {
+            alertBits = std::stod(argv[++i]);
+            continue;
+        }
+        if (arg == "--memo") {
+            useMemo = true;
+            continue;
+        }
+        if (arg == "--async") {
+            useAsync = true;
+            continue;
+        }
+        if (arg == "off") policy.mode = TRACE_OFF;
+        else if (arg == "checkpoint") policy.mode = TRACE_CHECKPOINT;
+        else if (arg == "end") policy.mode = TRACE_AT_END;
+        else if (arg == "every" && i + 1 < argc) policy.interval = std::stoi(argv[++i]);
+        policy.deferred = true;
+    }
+    auto backend = std::make_shared<OpenFHETraceBackend<DCRTPoly>>(cc, keys);
+    TraceableCiphertext<DCRTPoly> tc(backend, x, c, policy);    // x
+    auto recorder = std::make_shared<TraceRecorder>();          // 연산 DAG 기록
+    tc.setRecorder(recorder);
+    std::shared_ptr<PrecisionAnalyzer> analyzer;
+    if (alertBits >= 0) {
+        analyzer = std::make_shared<PrecisionAnalyzer>(alertBits);
+        tc.setPrecisionAnalyzer(analyzer);
+    }
+    std::shared_ptr<CircuitMemo<Ciphertext<DCRTPoly>>> memo;
+    if (useMemo) {
+        memo = std::make_shared<CircuitMemo<Ciphertext<DCRTPoly>>>();
+        tc.setMemo(memo);
+    }
     tc.showDetail();
 
     auto cplus1 = tc.cipherAdd(1);                     // x+1
+    std::cout << "Time to first op: "
+              << std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - programStart).count()
+              << " ms (" << (fromSnapshot ? "snapshot" : "keygen") << ")" << std::endl;
     auto cplus1_2 = cplus1.cipherMult(cplus1);        // (x+1)^2
     //auto cplus1_2_2 = cplus1.cipherAdd(cplus1);         // (x+1) + (x+1): 암호문+암호문 테스트
+    if (memo) {
+        auto doubled = cplus1.cipherAdd(cplus1);        // (x+1) + (x+1): 아래 (x+1)*2가 memo에서 이 결과를 재사용
+    }
     auto cplus1_2_2 = cplus1.cipherMult(2);             // (x+1)*2: 암호문*상수 테스트 -- 즉, 위와 같은 결과
     auto c2   = tc.cipherMult(tc);                      // x^2
     auto c2plus2 = c2.cipherAdd(2);                   // (x^2+2)
+    c2plus2.checkpoint("x^2+2");
 
     std::cout << "=== (x+1)^2 * (x^2+2) RESULT BELOW ===" << std::endl;
     auto cRes = cplus1_2.cipherMult(c2plus2);  // Final result
+    auto cRot = cRes.cipherRotate(2);          // left rotation 2
+    cRot.finish("(x+1)^2 * (x^2+2) << 2");     // 미뤄둔 검증 일괄 수행
+
+    cRot.getRotationSteps().save("rotation-steps.txt");     // 다음 실행의 rotation keygen에 사용
+
+    recorder->printSummary();                       // 연산별 소요 시간 비율, 레벨 소모 지점
+    if (memo)
+        printMemoStats(memo->getStats());
+    recorder->exportChromeTrace("traceable-cipher-test.json");  // chrome://tracing, ui.perfetto.dev에서 열기
+    recorder->exportBinary("traceable-cipher-test.trace");
+    if (analyzer) {
+        analyzer->exportJson("traceable-cipher-test-precision.json");
+        std::cout << "Precision reports: " << analyzer->getReports().size() << " (" << analyzer->getAlertCount()
+                  << " below " << alertBits << " bits) -> traceable-cipher-test-precision.json" << std::endl;
+    }
+
+    if (useAsync) {     // (x+1)^2와 x^2+2를 다른 worker에서 동시에 계산. 기록된 trace에 섞이지 않도록 추적 없는 입력 사용
+        TracePolicy off;
+        off.mode = TRACE_OFF;
+        TraceableCiphertext<DCRTPoly> input(backend, x, c, off);
+        auto timeMs = [](const std::function<void()>& fn) {
+            auto start = std::chrono::steady_clock::now();
+            fn();
+            return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+        };
+        double sequentialMs = timeMs([&] { input.cipherAdd(1).cipherSquare().cipherMult(input.cipherSquare().cipherAdd(2)); });
+
+        AsyncTraceCircuit<OpenFHETraceBackend<DCRTPoly>> circuit(2);
+        AsyncCiphertext<OpenFHETraceBackend<DCRTPoly>> result;
+        double asyncMs = timeMs([&] {
+            auto ax = circuit.input(input);
+            result  = ax.cipherAdd(1).cipherSquare().cipherMult(ax.cipherSquare().cipherAdd(2));
+            result.wait();
+        });
+        PrecisionReport report = result.get().analyzePrecision("async (x+1)^2 * (x^2+2)");
+        std::cout << "Async (x+1)^2 * (x^2+2): sequential " << sequentialMs << " ms, async " << asyncMs << " ms ("
+                  << circuit.getMaxParallelism() << " ops in parallel), " << report.precisionBits << " bits" << std::endl;
+    }
 
     return 0;
 }
\ No newline at end of file
@@ -30,136 +30,25 @@
 //==================================================================================
 
 /*
-  Operations for the representation of ciphertext in OpenFHE
- */
-
-#ifndef LBCRYPTO_CRYPTO_CIPHERTEXT_H
-#define LBCRYPTO_CRYPTO_CIPHERTEXT_H
+  TraceableCiphertext: OpenFHE용 TracedCiphertext
+  추적 기능(추적 정책, DAG 기록, 정밀도 분석, memo, hoisted 회전, 여러 스레드에서의 연산)은 모두 traced-ciphertext.h에 있고,
+  OpenFHE 연산은 OpenFHETraceBackend(openfhe-trace-backend.h)가 제공. SEAL에서 같은 회로를 실행하려면 task3/seal-trace-backend.h
 
-#include "ciphertext-fwd.h"
-#include "cryptoobject.h"
+    auto backend = std::make_shared<OpenFHETraceBackend<DCRTPoly>>(cc, keys);
+    TraceableCiphertext<DCRTPoly> x(backend, values, c, policy);     // c: values를 암호화한 암호문
+    auto y = x.cipherMult(x).cipherAdd(1.0);
+ */
 
-#include "metadata.h"
-#include "key/key.h"
-#include "key/privatekey-fwd.h"
+#ifndef LBCRYPTO_TRACE_TRACEABLE_CIPHERTEXT_H
+#define LBCRYPTO_TRACE_TRACEABLE_CIPHERTEXT_H
 
-#include <memory>             
-#include <string>
-#include <utility>
-#include <vector>
-#include <map>
+#include "openfhe-trace-backend.h"
+#include "traced-ciphertext.h"
 
 namespace lbcrypto {
 
-// ------------------------------- TraceableCiphertext
 template <typename Element>
-class TraceableCiphertext {
-private:
-    std::vector<std::complex<double>> originalVector;
-    Ciphertext<Element> ciphertext;
-    const PrivateKey<Element>& privateKey; 
-    const CryptoContext<Element>& cryptoContext;
-
-public:
-    TraceableCiphertext(std::vector<std::complex<double>> data,
-                        Ciphertext<Element> ct,
-                        const PrivateKey<Element>& pk,
-                        const CryptoContext<Element>& cc)
-        : originalVector(data), ciphertext(ct), privateKey(pk), cryptoContext(cc) {
-    }
-
-    std::vector<std::complex<double>> getOriginalVector() {
-        return originalVector;
-    }
-
-    Ciphertext<Element> getCiphertext() {
-        return ciphertext;
-    }
-
-    TraceableCiphertext cipherAdd(double constant) { // 암호문 + 상수
-        Ciphertext<Element> result = cryptoContext->EvalAdd(this->getCiphertext(), constant);
-        std::vector<std::complex<double>> vec = originalAdd(constant);
-        TraceableCiphertext tc(vec, result, privateKey, cryptoContext);
-        tc.showDetail();
-        return tc;
-    }
-
-    TraceableCiphertext cipherAdd(TraceableCiphertext<Element> cipher) {    // 암호문 + 암호문
-        Ciphertext<Element> result = cryptoContext->EvalAdd(this->getCiphertext(), cipher.getCiphertext());
-        std::vector<std::complex<double>> vec = originalAdd(cipher.getOriginalVector());
-        TraceableCiphertext tc(vec, result, privateKey, cryptoContext);
-        tc.showDetail();
-        return tc;
-    }
-
-    std::vector<std::complex<double>> originalAdd(double constant) {    // 암호문 + 상수 시 original vector 값 계산
-        std::vector<std::complex<double>> vec = this->getOriginalVector();
-
-        for (size_t i = 0; i < vec.size(); ++i) {
-            vec[i] += constant;
-        }
-        return vec;
-    }
-
-    std::vector<std::complex<double>> originalAdd(std::vector<std::complex<double>> vector) {   // 암호문 + 암호문 시 original vector 값 계산
-        std::vector<std::complex<double>> vec = this->getOriginalVector();
-
-        for (size_t i = 0; i < vec.size(); ++i) {
-            vec[i] += vector[i];
-        }
-        return vec;
-    }
-
-    TraceableCiphertext cipherMult(TraceableCiphertext<Element> cipher) { // 암호문 * 암호문
-        Ciphertext<Element> result = cryptoContext->EvalMult(this->getCiphertext(), cipher.getCiphertext());
-        std::vector<std::complex<double>> vec = originalMult(cipher.getOriginalVector());
-        TraceableCiphertext tc(vec, result, privateKey, cryptoContext);
-        tc.showDetail();
-        return tc;
-    }
-
-    TraceableCiphertext cipherMult(double constant) { // 암호문 * 상수
-        Ciphertext<Element> result = cryptoContext->EvalMult(this->getCiphertext(), constant);
-        std::vector<std::complex<double>> vec = originalMult(constant);
-        TraceableCiphertext tc(vec, result, privateKey, cryptoContext);
-        tc.showDetail();
-        return tc;
-    }
-    
-    std::vector<std::complex<double>> originalMult(std::vector<std::complex<double>> vec) { // 암호문 * 암호문 시 original vector 계산
-        std::vector<std::complex<double>> result = this->getOriginalVector();
-
-        for (size_t i = 0; i < vec.size(); ++i) {
-            result[i] *= vec[i];
-        }   
-        return result;
-    }
-
-    std::vector<std::complex<double>> originalMult(double constant) { // 암호문 * 상수 시 original vector 계산
-        std::vector<std::complex<double>> result = this->getOriginalVector();
-
-        for (size_t i = 0; i < result.size(); ++i) {
-            result[i] *= constant;
-        }   
-        return result;
-    }
-
-    Plaintext getDecrypted() {
-        Plaintext result;
-        cryptoContext->Decrypt(this->getCiphertext(), privateKey, &result);
-        result->SetLength(8);
-        return result;
-    }
-
-
-    void showDetail() {
-        std::cout << "Original Vector<Complex>: " << this->getOriginalVector() << std::endl;
-        std::cout << "Decrypted Vector<Complex>: " << this->getDecrypted();
-        std::cout << "\tScaling Factor: " << this->ciphertext->GetScalingFactor() << std::endl;
-        std::cout << "\tScaling Factor Degree: " << this->ciphertext->GetNoiseScaleDeg() << std::endl << std::endl;
-    }
-    
-};
+using TraceableCiphertext = TracedCiphertext<OpenFHETraceBackend<Element>>;
 
 }  // namespace lbcrypto
 
@@ -0,0 +1,688 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Backend-agnostic traced ciphertext
+  암호문과 같은 연산을 평문 벡터(original vector, shadow)에도 적용하면서 추적 정책에 따라 복호화 결과와 비교.
+  추적 기능(추적 정책, DAG 기록, 정밀도 분석, 회전 index 수집, memo, hoisted 회전, 여러 스레드에서의 연산)은 모두 여기에 있고
+  backend는 암호 연산만 제공. 같은 회로 코드를 SEAL(task3/seal-trace-backend.h)과 OpenFHE(openfhe-trace-backend.h)에서 실행
+  OpenFHE의 TraceableCiphertext<Element>(traceable-ciphertext.h)는 TracedCiphertext<OpenFHETraceBackend<Element>>
+
+  Backend가 제공해야 하는 것:
+    using Ciphertext;                                         공유 handle (std::shared_ptr 계열). get()은 memo key,
+                                                              use_count()는 in-place 연산 전 공유 여부 판단에 사용
+    Ciphertext encrypt(const std::vector<std::complex<double>>&);
+    std::vector<std::complex<double>> decrypt(const Ciphertext&);   모든 슬롯
+    Ciphertext clone(const Ciphertext&);                      깊은 복사
+    size_t slotCount() const;                                 회전 단위가 되는 슬롯 수
+    Ciphertext add(a, b), addConst(a, double)                 addInPlace(a&, b), addConstInPlace(a&, double)
+    Ciphertext sub(a, b), negate(a)                           레벨 소모 없음
+    Ciphertext mult(a, b), square(a), multConst(a, double)    multConstInPlace(a&, double). relinearize 포함
+    Ciphertext linearWSum(const std::vector<Ciphertext>&, const std::vector<double>&);   레벨 1 소모
+    Ciphertext rotate(const Ciphertext&, int32_t);            왼쪽 회전 (index < 0이면 오른쪽)
+    std::vector<Ciphertext> rotate(const Ciphertext&, const std::vector<int32_t>&);   같은 암호문의 여러 회전 (hoisting)
+    Ciphertext rescale(const Ciphertext&);                    대기 중인 rescale(noise scale degree 2)이 있으면 수행, 없으면 그대로
+    TraceInfo info(const Ciphertext&) const;                  DAG 노드에 기록할 레벨, 스케일, 크기
+    static const char* name();
+  여러 스레드에서 연산하려면(async-ciphertext.h) backend의 연산도 여러 스레드에서 호출 가능해야 함
+ */
+
+#ifndef LBCRYPTO_TRACE_TRACED_CIPHERTEXT_H
+#define LBCRYPTO_TRACE_TRACED_CIPHERTEXT_H
+
+#include "circuit-memo.h"
+#include "precision-analyzer.h"
+#include "rotation-steps.h"
+#include "shadow-kernels.h"
+#include "trace-policy.h"
+#include "trace-recorder.h"
+
+#include <algorithm>
+#include <chrono>
+#include <complex>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace lbcrypto {
+
+// DAG 노드에 기록할 암호문 상태
+struct TraceInfo {
+    uint32_t level         = 0;  // 소모한 레벨 수
+    uint32_t noiseScaleDeg = 1;
+    double scalingFactor   = 0;
+    uint64_t bytes         = 0;
+};
+
+// 같은 입력에서 파생된 TracedCiphertext들이 공유하는 상태
+template <typename Backend>
+struct TracedState {
+    // 검증 시점의 암호문(복제본)과 original vector. 복호화는 flushTrace()까지 미뤄짐
+    struct Pending {
+        std::string label;
+        typename Backend::Ciphertext ciphertext;
+        std::vector<std::complex<double>> originalVector;
+    };
+
+    std::shared_ptr<Backend> backend;
+    TracePolicy policy;
+    uint64_t opCount = 0;
+    std::vector<Pending> pending;
+    std::shared_ptr<TraceRecorder> recorder;       // 설정된 경우 모든 연산을 DAG 노드로 기록
+    std::shared_ptr<PrecisionAnalyzer> analyzer;   // 설정된 경우 검증 결과를 출력하지 않고 모든 슬롯의 오차 보고서로 기록
+    std::shared_ptr<CircuitMemo<typename Backend::Ciphertext>> memo;   // 설정된 경우 같은 (연산, 피연산자, 상수)의 결과를 재사용
+    RotationSteps rotationSteps;                   // 회로에서 사용한 회전 index. 필요한 rotation key만 생성하는 데 사용
+    std::mutex mtx;                                // 여러 스레드에서 연산할 때(async-ciphertext.h) opCount, pending, rotationSteps 보호
+};
+
+// ------------------------------- TracedCiphertext
+template <typename Backend>
+class TracedCiphertext {
+public:
+    using Ciphertext = typename Backend::Ciphertext;
+    using Memo       = CircuitMemo<Ciphertext>;
+
+private:
+    using TraceClock = std::chrono::steady_clock;
+
+    std::vector<std::complex<double>> originalVector;
+    Ciphertext ciphertext;
+    std::shared_ptr<TracedState<Backend>> state;
+    uint64_t nodeId = 0;    // recorder에 기록된 이 암호문의 노드 id (0: 기록되지 않음)
+
+    TracedCiphertext(std::vector<std::complex<double>> data, Ciphertext ct, std::shared_ptr<TracedState<Backend>> state)
+        : originalVector(std::move(data)), ciphertext(std::move(ct)), state(std::move(state)) {}
+
+    Backend& backend() const {
+        return *state->backend;
+    }
+
+    void recordNode(const std::string& op, TraceClock::time_point start, TraceClock::time_point end,
+                    std::vector<uint64_t> operands, double constant = 0, std::vector<double> weights = {}) {    // recorder가 있으면 이 암호문을 새 노드로 기록
+        const std::shared_ptr<TraceRecorder>& recorder = state->recorder;
+        if (!recorder)
+            return;
+        TraceInfo info = backend().info(ciphertext);
+        TraceNode node;
+        node.op            = op;
+        node.operands      = std::move(operands);
+        node.level         = info.level;
+        node.noiseScaleDeg = info.noiseScaleDeg;
+        node.scalingFactor = info.scalingFactor;
+        node.startUs       = recorder->toUs(start);
+        node.latencyUs     = std::chrono::duration<double, std::micro>(end - start).count();
+        node.bytes         = info.bytes;
+        node.constant      = constant;
+        node.weights       = std::move(weights);
+        nodeId             = recorder->addNode(std::move(node));
+    }
+
+    // 연산 직후 호출. 노드를 기록하고 정책에 따라 검증 여부 결정
+    void traceOp(const std::string& op, TraceClock::time_point start, TraceClock::time_point end,
+                 std::vector<uint64_t> operands, double constant = 0, std::vector<double> weights = {}) {
+        recordNode(op, start, end, std::move(operands), constant, std::move(weights));
+        uint64_t count;
+        {
+            std::lock_guard<std::mutex> lock(state->mtx);
+            count = ++state->opCount;
+        }
+        const TracePolicy& policy = state->policy;
+        if (policy.mode == TRACE_EVERY_NTH && policy.interval > 0 && count % policy.interval == 0)
+            check("#" + std::to_string(count) + " " + op);
+    }
+
+    // 연산 결과를 새 TracedCiphertext로 감싸고 기록, 정책에 따라 검증
+    TracedCiphertext result(std::vector<std::complex<double>> shadow, Ciphertext ct, const std::string& op,
+                            TraceClock::time_point start, std::vector<uint64_t> operands, double constant = 0,
+                            std::vector<double> weights = {}) const {
+        TraceClock::time_point end = TraceClock::now();
+        TracedCiphertext tc(std::move(shadow), std::move(ct), state);
+        tc.traceOp(op, start, end, std::move(operands), constant, std::move(weights));
+        return tc;
+    }
+
+    void check(const std::string& label) const {  // 즉시 검증하거나 큐에 추가
+        // 잠금은 pending에만. verify(복호화, 출력, alert handler)는 잠금 밖에서: 다른 스레드의 연산을 막지 않음
+        if (state->policy.deferred) {
+            typename TracedState<Backend>::Pending item{label, backend().clone(ciphertext), originalVector};   // 이후 in-place 연산과 무관하도록 복제
+            std::lock_guard<std::mutex> lock(state->mtx);
+            state->pending.push_back(std::move(item));
+        }
+        else {
+            verify(label, originalVector, ciphertext);
+        }
+    }
+
+    void verify(const std::string& label, const std::vector<std::complex<double>>& original, const Ciphertext& ct) const {
+        std::vector<std::complex<double>> decrypted = backend().decrypt(ct);
+        if (state->analyzer) {
+            state->analyzer->analyze(label, decrypted, original);
+            return;
+        }
+        std::cout << "[" << label << "]" << std::endl;
+        showDetail(original, ct, decrypted);
+    }
+
+    void showDetail(const std::vector<std::complex<double>>& original, const Ciphertext& ct,
+                    const std::vector<std::complex<double>>& decrypted) const {   // 앞의 8개 슬롯만
+        const size_t shown = std::min<size_t>(8, original.size());
+        TraceInfo info     = backend().info(ct);
+        std::cout << "Original Vector<Complex>: ";
+        for (size_t i = 0; i < shown; ++i)
+            std::cout << original[i] << " ";
+        std::cout << std::endl << "Decrypted Vector<Complex> (" << Backend::name() << "): ";
+        for (size_t i = 0; i < shown && i < decrypted.size(); ++i)
+            std::cout << decrypted[i] << " ";
+        std::cout << std::endl;
+        std::cout << "\tScaling Factor: " << info.scalingFactor << std::endl;
+        std::cout << "\tScaling Factor Degree: " << info.noiseScaleDeg << std::endl;
+        std::cout << "\tLevel: " << info.level << std::endl << std::endl;
+    }
+
+    // memo에 같은 연산의 결과가 있으면 그 암호문, original vector, 노드 id로 새 객체를 만듦 (연산 횟수, 검증, 기록 없음)
+    std::optional<TracedCiphertext> recall(const MemoKey& key) const {
+        return recall(key, key.op);
+    }
+
+    std::optional<TracedCiphertext> recall(const MemoKey& key, MemoOp saved) const {
+        if (!state->memo)
+            return std::nullopt;
+        auto entry = state->memo->find(key, saved);
+        if (!entry)
+            return std::nullopt;
+        TracedCiphertext tc(entry->originalVector, entry->ciphertext, state);
+        tc.nodeId = entry->nodeId;
+        return tc;
+    }
+
+    void remember(const MemoKey& key, const TracedCiphertext& result, const Ciphertext& rhs = nullptr) const {
+        if (state->memo)
+            state->memo->insert(key, {result.ciphertext, result.originalVector, result.nodeId, ciphertext, rhs});
+    }
+
+    void addRotationStep(int32_t index) const {
+        std::lock_guard<std::mutex> lock(state->mtx);
+        state->rotationSteps.add(index);
+    }
+
+    // in-place 연산 전에 호출. 암호문을 다른 객체(복사본, TracedExpr의 leaf, memo 등)와 공유하고 있으면 복제해서 단독 소유로 만듦
+    void ownCiphertext() {
+        if (ciphertext.use_count() != 1)
+            ciphertext = backend().clone(ciphertext);
+    }
+
+    // in-place 연산을 memo 경유로 수행할 때 결과로 교체. memo의 암호문은 제자리에서 바뀌지 않아야 함
+    void replaceWith(TracedCiphertext&& other) {
+        ciphertext     = std::move(other.ciphertext);
+        originalVector = std::move(other.originalVector);
+        nodeId         = other.nodeId;
+    }
+
+public:
+    // values를 암호화해서 추적을 시작. 이후 연산 결과는 모두 같은 backend와 추적 상태를 공유
+    TracedCiphertext(std::shared_ptr<Backend> backend, std::vector<std::complex<double>> values,
+                     const TracePolicy& policy = TracePolicy())
+        : originalVector(std::move(values)), state(std::make_shared<TracedState<Backend>>()) {
+        state->backend = std::move(backend);
+        state->policy  = policy;
+        ciphertext     = state->backend->encrypt(originalVector);
+    }
+
+    // 이미 암호화된 ct(= values를 암호화한 것)로 추적을 시작
+    TracedCiphertext(std::shared_ptr<Backend> backend, std::vector<std::complex<double>> values, Ciphertext ct,
+                     const TracePolicy& policy = TracePolicy())
+        : originalVector(std::move(values)), ciphertext(std::move(ct)), state(std::make_shared<TracedState<Backend>>()) {
+        state->backend = std::move(backend);
+        state->policy  = policy;
+    }
+
+    // 같은 추적 상태를 공유하는 두 번째 입력 (예: y를 x와 같은 회로에서 사용)
+    TracedCiphertext encryptSibling(std::vector<std::complex<double>> values) const {
+        Ciphertext ct = backend().encrypt(values);
+        TracedCiphertext tc(std::move(values), std::move(ct), state);
+        TraceClock::time_point now = TraceClock::now();
+        tc.recordNode("input", now, now, {});
+        return tc;
+    }
+
+    void setTracePolicy(const TracePolicy& policy) {
+        state->policy = policy;
+    }
+
+    const TracePolicy& getTracePolicy() const {
+        return state->policy;
+    }
+
+    // recorder를 설정하면 이후 연산이 DAG 노드로 기록됨. 현재 암호문은 "input" 노드로 기록
+    void setRecorder(std::shared_ptr<TraceRecorder> recorder) {
+        state->recorder            = std::move(recorder);
+        TraceClock::time_point now = TraceClock::now();
+        recordNode("input", now, now, {});
+    }
+
+    const std::shared_ptr<TraceRecorder>& getRecorder() const {
+        return state->recorder;
+    }
+
+    // analyzer를 설정하면 이후 검증(매 연산, checkpoint, finish)은 출력 대신 analyzer에 보고서로 쌓임
+    void setPrecisionAnalyzer(std::shared_ptr<PrecisionAnalyzer> analyzer) {
+        state->analyzer = std::move(analyzer);
+    }
+
+    const std::shared_ptr<PrecisionAnalyzer>& getPrecisionAnalyzer() const {
+        return state->analyzer;
+    }
+
+    // memo를 설정하면 이후 같은 입력에서 파생된 객체의 연산 결과를 재사용. in-place 연산도 새 암호문을 만듦
+    void setMemo(std::shared_ptr<Memo> memo) {
+        state->memo = std::move(memo);
+    }
+
+    const std::shared_ptr<Memo>& getMemo() const {
+        return state->memo;
+    }
+
+    const std::shared_ptr<Backend>& getBackend() const {
+        return state->backend;
+    }
+
+    const RotationSteps& getRotationSteps() const {    // 지금까지 회로에서 사용한 회전 index
+        return state->rotationSteps;
+    }
+
+    uint64_t getOpCount() const {
+        return state->opCount;
+    }
+
+    size_t getPendingCount() const {
+        std::lock_guard<std::mutex> lock(state->mtx);
+        return state->pending.size();
+    }
+
+    uint64_t getNodeId() const {
+        return nodeId;
+    }
+
+    const Ciphertext& getCiphertext() const {
+        return ciphertext;
+    }
+
+    const std::vector<std::complex<double>>& getOriginalVector() const {
+        return originalVector;
+    }
+
+    size_t slotCount() const {     // 회전 단위가 되는 슬롯 수 (batch size)
+        return backend().slotCount();
+    }
+
+    std::vector<std::complex<double>> decrypt() const {    // 모든 슬롯
+        return backend().decrypt(ciphertext);
+    }
+
+    // 정책과 관계없이 지금 이 암호문의 정밀도를 분석. analyzer가 없으면 기록하지 않는 임시 analyzer 사용
+    PrecisionReport analyzePrecision(const std::string& label) const {
+        if (state->analyzer)
+            return state->analyzer->analyze(label, decrypt(), originalVector);
+        PrecisionAnalyzer analyzer;
+        return analyzer.analyze(label, decrypt(), originalVector);
+    }
+
+    void showDetail() const {      // 원래 벡터값, 복호화한 값, scaling factor, 레벨 출력
+        showDetail(originalVector, ciphertext, decrypt());
+    }
+
+    void showDetail(const std::string& label) const {
+        std::cout << "[" << label << "]" << std::endl;
+        showDetail();
+    }
+
+    void checkpoint(const std::string& name) const {  // 이름 붙은 검증 지점. TRACE_OFF, TRACE_AT_END에서는 무시
+        TraceMode mode = state->policy.mode;
+        if (mode == TRACE_EVERY_NTH || mode == TRACE_CHECKPOINT)
+            check(name);
+    }
+
+    void flushTrace() const {     // 큐에 쌓인 검증을 한꺼번에 수행
+        std::vector<typename TracedState<Backend>::Pending> pending;
+        {
+            std::lock_guard<std::mutex> lock(state->mtx);
+            pending.swap(state->pending);
+        }
+        for (const auto& item : pending)
+            verify(item.label, item.originalVector, item.ciphertext);
+    }
+
+    void finish(const std::string& name = "final") const {   // 회로 끝. TRACE_AT_END면 이 결과를 검증하고, 남은 큐를 비움
+        if (state->policy.mode == TRACE_AT_END) {
+            typename TracedState<Backend>::Pending item{name, backend().clone(ciphertext), originalVector};
+            std::lock_guard<std::mutex> lock(state->mtx);
+            state->pending.push_back(std::move(item));
+        }
+        flushTrace();
+    }
+
+    // 복사 연산: 결과 객체를 새로 만듦
+    TracedCiphertext cipherAdd(double constant) const& { // 암호문 + 상수
+        MemoKey key(MemoOp::ADD_CONST, ciphertext.get(), nullptr, constant);
+        if (auto hit = recall(key))
+            return std::move(*hit);
+        TraceClock::time_point start = TraceClock::now();
+        Ciphertext ct                = backend().addConst(ciphertext, constant);
+        TracedCiphertext tc = result(originalAdd(constant), std::move(ct), "cipherAdd(const)", start, {nodeId}, constant);
+        remember(key, tc);
+        return tc;
+    }
+
+    TracedCiphertext cipherAdd(const TracedCiphertext& cipher) const& {    // 암호문 + 암호문
+        // x + x도 ADD key. x * 2의 결과(레벨 사용)는 재사용하지 않음
+        MemoKey key(MemoOp::ADD, ciphertext.get(), cipher.ciphertext.get());
+        if (auto hit = recall(key))
+            return std::move(*hit);
+        TraceClock::time_point start = TraceClock::now();
+        Ciphertext ct                = backend().add(ciphertext, cipher.ciphertext);
+        TracedCiphertext tc = result(originalAdd(cipher.originalVector), std::move(ct), "cipherAdd", start, {nodeId, cipher.nodeId});
+        remember(key, tc, cipher.ciphertext);
+        return tc;
+    }
+
+    TracedCiphertext cipherSub(const TracedCiphertext& cipher) const {    // 암호문 - 암호문
+        MemoKey key(MemoOp::SUB, ciphertext.get(), cipher.ciphertext.get());
+        if (auto hit = recall(key))
+            return std::move(*hit);
+        TraceClock::time_point start = TraceClock::now();
+        Ciphertext ct                = backend().sub(ciphertext, cipher.ciphertext);
+        TracedCiphertext tc = result(originalSub(cipher.originalVector), std::move(ct), "cipherSub", start, {nodeId, cipher.nodeId});
+        remember(key, tc, cipher.ciphertext);
+        return tc;
+    }
+
+    TracedCiphertext cipherNegate() const {     // -암호문. 상수 -1 곱셈과 달리 레벨을 소모하지 않음
+        MemoKey key(MemoOp::NEGATE, ciphertext.get());
+        if (auto hit = recall(key))
+            return std::move(*hit);
+        TraceClock::time_point start = TraceClock::now();
+        Ciphertext ct                = backend().negate(ciphertext);
+        TracedCiphertext tc = result(originalMult(-1.0), std::move(ct), "cipherNegate", start, {nodeId});
+        remember(key, tc);
+        return tc;
+    }
+
+    TracedCiphertext cipherMult(const TracedCiphertext& cipher) const& { // 암호문 * 암호문
+        if (cipher.ciphertext == ciphertext)
+            return cipherSquare();
+        MemoKey key(MemoOp::MULT, ciphertext.get(), cipher.ciphertext.get());
+        if (auto hit = recall(key))
+            return std::move(*hit);
+        TraceClock::time_point start = TraceClock::now();
+        Ciphertext ct                = backend().mult(ciphertext, cipher.ciphertext);
+        TracedCiphertext tc = result(originalMult(cipher.originalVector), std::move(ct), "cipherMult", start, {nodeId, cipher.nodeId});
+        remember(key, tc, cipher.ciphertext);
+        return tc;
+    }
+
+    TracedCiphertext cipherMult(double constant) const& { // 암호문 * 상수
+        // x * 2: x + x의 결과가 있으면 재사용 (값이 같고 레벨을 쓰지 않음)
+        if (constant == 2) {
+            if (auto hit = recall(MemoKey(MemoOp::ADD, ciphertext.get(), ciphertext.get()), MemoOp::MULT_CONST))
+                return std::move(*hit);
+        }
+        MemoKey key(MemoOp::MULT_CONST, ciphertext.get(), nullptr, constant);
+        if (auto hit = recall(key))
+            return std::move(*hit);
+        TraceClock::time_point start = TraceClock::now();
+        Ciphertext ct                = backend().multConst(ciphertext, constant);
+        TracedCiphertext tc = result(originalMult(constant), std::move(ct), "cipherMult(const)", start, {nodeId}, constant);
+        remember(key, tc);
+        return tc;
+    }
+
+    // x * x: 같은 다항식 곱을 한 번 덜 계산. cipherMult(x)에 자기 자신을 넘기면 자동으로 사용
+    TracedCiphertext cipherSquare() const {
+        MemoKey key(MemoOp::SQUARE, ciphertext.get());
+        if (auto hit = recall(key))
+            return std::move(*hit);
+        if (state->memo)
+            state->memo->noteSquare();
+        TraceClock::time_point start = TraceClock::now();
+        Ciphertext ct                = backend().square(ciphertext);
+        TracedCiphertext tc = result(originalMult(originalVector), std::move(ct), "cipherSquare", start, {nodeId, nodeId});
+        remember(key, tc);
+        return tc;
+    }
+
+    // sum_i weights[i] * terms[i] + constant 를 연산 하나로 계산 (linearWSum 후 상수는 한 번만 더함). 레벨 1 소모
+    // 항마다 cipherMult(상수) + cipherAdd를 호출하는 것보다 RNS limb를 훑는 횟수가 적음. traced-expression.h에서 사용
+    static TracedCiphertext cipherLinearWSum(const std::vector<const TracedCiphertext*>& terms,
+                                             const std::vector<double>& weights, double constant = 0) {
+        if (terms.empty() || terms.size() != weights.size())
+            throw std::invalid_argument("TracedCiphertext: cipherLinearWSum needs one weight per term");
+        const TracedCiphertext& first = *terms.front();
+        std::vector<Ciphertext> ciphertexts;
+        std::vector<uint64_t> operands;
+        size_t length = 0;
+        for (const TracedCiphertext* term : terms) {
+            ciphertexts.push_back(term->ciphertext);
+            operands.push_back(term->nodeId);
+            length = std::max(length, term->originalVector.size());
+        }
+        TraceClock::time_point start = TraceClock::now();
+        Ciphertext ct                = first.backend().linearWSum(ciphertexts, weights);
+        if (constant != 0)
+            first.backend().addConstInPlace(ct, constant);
+        std::vector<std::complex<double>> shadow(length);
+        for (size_t i = 0; i < terms.size(); ++i)
+            ShadowAxpyInPlace(shadow, terms[i]->originalVector, weights[i]);
+        ShadowAddInPlace(shadow, constant);
+        return first.result(std::move(shadow), std::move(ct), "cipherLinearWSum", start, std::move(operands), constant, weights);
+    }
+
+    // rvalue 연산: 임시 객체의 original vector 버퍼를 그대로 재사용 (할당 없음). 암호문은 단독 소유일 때만 제자리에서 갱신
+    TracedCiphertext cipherAdd(double constant) && {
+        *this += constant;
+        return std::move(*this);
+    }
+
+    TracedCiphertext cipherAdd(const TracedCiphertext& cipher) && {
+        *this += cipher;
+        return std::move(*this);
+    }
+
+    TracedCiphertext cipherMult(const TracedCiphertext& cipher) && {
+        *this *= cipher;
+        return std::move(*this);
+    }
+
+    TracedCiphertext cipherMult(double constant) && {
+        *this *= constant;
+        return std::move(*this);
+    }
+
+    // in-place 연산: 암호문과 original vector를 제자리에서 갱신. 암호문을 공유 중이면 먼저 복제 (다른 객체의 값은 바뀌지 않음)
+    TracedCiphertext& operator+=(double constant) {
+        if (state->memo) {
+            replaceWith(cipherAdd(constant));
+            return *this;
+        }
+        ownCiphertext();
+        TraceClock::time_point start = TraceClock::now();
+        backend().addConstInPlace(ciphertext, constant);
+        TraceClock::time_point end = TraceClock::now();
+        ShadowAddInPlace(originalVector, constant);
+        traceOp("cipherAdd(const)", start, end, {nodeId}, constant);
+        return *this;
+    }
+
+    TracedCiphertext& operator+=(const TracedCiphertext& cipher) {
+        if (state->memo) {
+            replaceWith(cipherAdd(cipher));
+            return *this;
+        }
+        const uint64_t cipherNode = cipher.nodeId;  // x += x: 아래에서 nodeId가 바뀌기 전에 읽음
+        // 다른 handle이 같은 암호문을 공유할 때만 복제. x += x는 handle이 하나(use_count 1)라 복제하지 않고
+        // 같은 객체를 두 피연산자로 더함: 원소별 덧셈이라 aliasing이 있어도 결과가 맞음
+        ownCiphertext();
+        TraceClock::time_point start = TraceClock::now();
+        backend().addInPlace(ciphertext, cipher.ciphertext);
+        TraceClock::time_point end = TraceClock::now();
+        ShadowAddInPlace(originalVector, cipher.originalVector);
+        traceOp("cipherAdd", start, end, {nodeId, cipherNode});
+        return *this;
+    }
+
+    TracedCiphertext& operator*=(const TracedCiphertext& cipher) {
+        if (state->memo || cipher.ciphertext == ciphertext) {
+            replaceWith(cipherMult(cipher));
+            return *this;
+        }
+        TraceClock::time_point start = TraceClock::now();
+        ciphertext = backend().mult(ciphertext, cipher.ciphertext);    // 암호문*암호문은 in-place 버전이 없음
+        TraceClock::time_point end = TraceClock::now();
+        ShadowMultInPlace(originalVector, cipher.originalVector);
+        traceOp("cipherMult", start, end, {nodeId, cipher.nodeId});
+        return *this;
+    }
+
+    TracedCiphertext& operator*=(double constant) {
+        if (state->memo) {
+            replaceWith(cipherMult(constant));
+            return *this;
+        }
+        ownCiphertext();
+        TraceClock::time_point start = TraceClock::now();
+        backend().multConstInPlace(ciphertext, constant);
+        TraceClock::time_point end = TraceClock::now();
+        ShadowMultInPlace(originalVector, constant);
+        traceOp("cipherMult(const)", start, end, {nodeId}, constant);
+        return *this;
+    }
+
+    TracedCiphertext cipherRotate(int32_t index) const { // 암호문 회전 (index > 0: 왼쪽)
+        addRotationStep(index);
+        MemoKey key(MemoOp::ROTATE, ciphertext.get(), nullptr, index);
+        if (auto hit = recall(key))
+            return std::move(*hit);
+        TraceClock::time_point start = TraceClock::now();
+        Ciphertext ct                = backend().rotate(ciphertext, index);
+        TracedCiphertext tc = result(originalRotate(index), std::move(ct), "cipherRotate(" + std::to_string(index) + ")", start, {nodeId});
+        remember(key, tc);
+        return tc;
+    }
+
+    // 같은 암호문을 여러 index로 회전. backend가 키 스위칭의 분해를 한 번만 계산(hoisting)하고 모든 회전에서 재사용
+    std::vector<TracedCiphertext> cipherRotate(const std::vector<int32_t>& indices) const {
+        std::vector<TracedCiphertext> results;
+        results.reserve(indices.size());
+        if (indices.empty())
+            return results;
+        // memo에 있는 index는 재사용하고, 나머지만 backend에 넘김
+        std::vector<std::optional<TracedCiphertext>> hits;
+        std::vector<int32_t> misses;
+        for (int32_t index : indices) {
+            addRotationStep(index);
+            hits.push_back(recall(MemoKey(MemoOp::ROTATE, ciphertext.get(), nullptr, index)));
+            if (!hits.back())
+                misses.push_back(index);
+        }
+
+        std::vector<Ciphertext> rotated;
+        TraceClock::duration share{0};
+        TraceClock::time_point start = TraceClock::now();
+        if (!misses.empty()) {
+            rotated = backend().rotate(ciphertext, misses);
+            share   = (TraceClock::now() - start) / misses.size();   // 전체 시간을 회전 수로 나누어 각 노드에 분배
+        }
+        for (size_t i = 0, next = 0; i < indices.size(); ++i) {
+            if (hits[i]) {
+                results.push_back(std::move(*hits[i]));
+                continue;
+            }
+            const int32_t index = indices[i];
+            TracedCiphertext tc(originalRotate(index), std::move(rotated[next]), state);
+            tc.traceOp("cipherRotate(" + std::to_string(index) + ")", start + share * next, start + share * (next + 1), {nodeId});
+            remember(MemoKey(MemoOp::ROTATE, ciphertext.get(), nullptr, index), tc);
+            results.push_back(std::move(tc));
+            ++next;
+        }
+        return results;
+    }
+
+    // 대기 중인 rescale을 지금 수행 (두 backend 모두 같은 의미). 대기 중인 rescale이 없으면 암호문은 그대로
+    TracedCiphertext cipherRescale() const {
+        TraceClock::time_point start = TraceClock::now();
+        Ciphertext ct                = backend().rescale(ciphertext);
+        return result(originalVector, std::move(ct), "cipherRescale", start, {nodeId});
+    }
+
+    std::vector<std::complex<double>> originalRotate(int32_t index) const { // 회전 시 original vector 계산
+        std::vector<std::complex<double>> result;
+        ShadowRotate(result, originalVector, index, slotCount());
+        return result;
+    }
+
+    std::vector<std::complex<double>> originalAdd(double constant) const {    // 암호문 + 상수 시 original vector 값 계산
+        std::vector<std::complex<double>> vec = originalVector;
+        ShadowAddInPlace(vec, constant);
+        return vec;
+    }
+
+    std::vector<std::complex<double>> originalAdd(const std::vector<std::complex<double>>& vector) const {   // 암호문 + 암호문 시 original vector 값 계산
+        std::vector<std::complex<double>> vec = originalVector;
+        ShadowAddInPlace(vec, vector);
+        return vec;
+    }
+
+    std::vector<std::complex<double>> originalSub(const std::vector<std::complex<double>>& vector) const {   // 암호문 - 암호문 시 original vector 값 계산
+        std::vector<std::complex<double>> vec = originalVector;
+        ShadowAxpyInPlace(vec, vector, -1.0);
+        return vec;
+    }
+
+    std::vector<std::complex<double>> originalMult(const std::vector<std::complex<double>>& vec) const { // 암호문 * 암호문 시 original vector 계산
+        std::vector<std::complex<double>> result = originalVector;
+        ShadowMultInPlace(result, vec);
+        return result;
+    }
+
+    std::vector<std::complex<double>> originalMult(double constant) const { // 암호문 * 상수 시 original vector 계산
+        std::vector<std::complex<double>> result = originalVector;
+        ShadowMultInPlace(result, constant);
+        return result;
+    }
+};
+
+}  // namespace lbcrypto
+
+#endif
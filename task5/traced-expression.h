@@ -0,0 +1,293 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Lazy expression front end for TracedCiphertext (TraceableCiphertext 포함)
+  연산자(+, -, *)로 식을 만들어 두고 evaluate()에서 식 전체를 한꺼번에 lowering
+  - 모든 식은 constant + sum_i w_i * atom_i 형태로 정규화. atom = 입력 암호문 또는 암호문*암호문 곱
+  - 상수 덧셈은 하나로 합쳐짐 ((x+1)+2 → x+3), 상수 곱셈은 가중치에 흡수 ((x*2)*3 → x*6, (2x)*(3y) → 6(x*y))
+  - 같은 atom의 항은 합쳐짐 (x*2 + x*3 → x*5, x - x → 항 제거)
+  - lowering: 가중치 ±1은 cipherAdd, cipherSub, cipherNegate, 작은 정수(|w| <= 16)는 double-and-add (레벨 소모 없음)
+    정수가 아닌 가중치의 항만 cipherMult(상수)(항 하나) 또는 cipherLinearWSum(backend의 linearWSum) 한 번으로 레벨 1 소모
+    같은 atom, 같은 식 객체(Linear)는 한 번만 계산. 같은 모양이라도 따로 만든 식(x + 1을 두 번 쓰기)은 따로 계산
+ */
+
+#ifndef LBCRYPTO_TRACE_TRACED_EXPRESSION_H
+#define LBCRYPTO_TRACE_TRACED_EXPRESSION_H
+
+#include "traced-ciphertext.h"
+
+#include <cmath>
+#include <map>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+namespace lbcrypto {
+
+// ------------------------------- TracedExpr
+template <typename Backend>
+class TracedExpr {
+private:
+    struct Atom;
+
+    struct Term {
+        std::shared_ptr<const Atom> atom;
+        double weight;
+    };
+
+    // constant + sum terms[i].weight * terms[i].atom
+    struct Linear {
+        std::vector<Term> terms;
+        double constant = 0;
+    };
+
+    using LinearPtr = std::shared_ptr<const Linear>;
+
+    static constexpr double MAX_INTEGER_BY_ADDITION = 16;   // 이 이하의 정수 가중치는 덧셈으로 곱함 (PolyEvaluator와 같은 기준)
+
+    struct Atom {
+        std::shared_ptr<const TracedCiphertext<Backend>> leaf;   // 입력 암호문. nullptr면 lhs * rhs
+        LinearPtr lhs, rhs;
+
+        // 같은 atom인지 판단하는 key: 입력은 암호문 객체, 곱은 노드 자체
+        const void* key() const {
+            return leaf ? static_cast<const void*>(leaf->getCiphertext().get()) : this;
+        }
+    };
+
+    // lowering 결과. 같은 식 객체(예: auto t = x + 1; t * t의 t)는 한 번만 계산
+    struct Memo {
+        std::map<const Atom*, TracedCiphertext<Backend>> atoms;
+        std::map<const Linear*, TracedCiphertext<Backend>> linears;
+    };
+
+    LinearPtr linear;
+
+    explicit TracedExpr(Linear linear) : linear(std::make_shared<const Linear>(std::move(linear))) {}
+
+    static Linear add(const Linear& a, const Linear& b) {
+        Linear result = a;
+        for (const Term& term : b.terms) {
+            auto it = result.terms.begin();
+            while (it != result.terms.end() && it->atom->key() != term.atom->key())
+                ++it;
+            if (it == result.terms.end())
+                result.terms.push_back(term);
+            else if ((it->weight += term.weight) == 0)
+                result.terms.erase(it);
+        }
+        result.constant += b.constant;
+        return result;
+    }
+
+    static Linear scale(const Linear& a, double constant) {
+        Linear result;
+        if (constant == 0)
+            return result;
+        result = a;
+        for (Term& term : result.terms)
+            term.weight *= constant;
+        result.constant *= constant;
+        return result;
+    }
+
+    // 항 하나, 상수 0이면 가중치를 밖으로 꺼냄: 곱 뒤의 상수 곱셈 한 번으로 합쳐짐
+    static LinearPtr factor(const LinearPtr& a, double& weight) {
+        if (a->terms.size() != 1 || a->constant != 0 || a->terms[0].weight == 1)
+            return a;
+        weight *= a->terms[0].weight;
+        Linear unit;
+        unit.terms.push_back({a->terms[0].atom, 1});
+        return std::make_shared<const Linear>(std::move(unit));
+    }
+
+    static Linear mult(const LinearPtr& a, const LinearPtr& b) {
+        if (a->terms.empty())
+            return scale(*b, a->constant);
+        if (b->terms.empty())
+            return scale(*a, b->constant);
+        double weight = 1;
+        auto atom     = std::make_shared<Atom>();
+        atom->lhs     = factor(a, weight);
+        atom->rhs     = factor(b, weight);
+        Linear result;
+        result.terms.push_back({std::move(atom), weight});
+        return result;
+    }
+
+    static const TracedCiphertext<Backend>& lowerAtom(const Atom& atom, Memo& memo) {
+        if (atom.leaf)
+            return *atom.leaf;
+        auto it = memo.atoms.find(&atom);
+        if (it == memo.atoms.end()) {
+            const TracedCiphertext<Backend>& lhs = lower(atom.lhs, memo);
+            const TracedCiphertext<Backend>& rhs = lower(atom.rhs, memo);
+            it = memo.atoms.emplace(&atom, lhs.cipherMult(rhs)).first;
+        }
+        return it->second;
+    }
+
+    static const TracedCiphertext<Backend>& lower(const LinearPtr& linear, Memo& memo) {
+        auto it = memo.linears.find(linear.get());
+        if (it == memo.linears.end())
+            it = memo.linears.emplace(linear.get(), lowerLinear(*linear, memo)).first;
+        return it->second;
+    }
+
+    static bool isSmallInteger(double w) {
+        return w == std::round(w) && std::fabs(w) <= MAX_INTEGER_BY_ADDITION;
+    }
+
+    // n * v (n >= 1)를 double-and-add로: 덧셈만 쓰므로 레벨 소모 없음. v + v는 memo의 ADD(v, v) key
+    static TracedCiphertext<Backend> multiplyByAddition(const TracedCiphertext<Backend>& v, uint64_t n) {
+        std::optional<TracedCiphertext<Backend>> acc;
+        TracedCiphertext<Backend> base = v;
+        while (n) {
+            if (n & 1)
+                acc = acc ? acc->cipherAdd(base) : base;
+            n >>= 1;
+            if (n)
+                base = base.cipherAdd(base);
+        }
+        return std::move(*acc);
+    }
+
+    static void accumulate(std::optional<TracedCiphertext<Backend>>& sum, TracedCiphertext<Backend>&& term) {
+        if (sum)
+            *sum += term;
+        else
+            sum = std::move(term);
+    }
+
+    // 정수 가중치(|w| <= MAX_INTEGER_BY_ADDITION)는 덧셈, 뺄셈, negate로 (레벨 소모 없음)
+    // 정수가 아닌 가중치의 항만 cipherMult(상수) 또는 cipherLinearWSum 한 번 (레벨 1 소모)
+    static TracedCiphertext<Backend> lowerLinear(const Linear& linear, Memo& memo) {
+        if (linear.terms.empty())
+            throw std::logic_error("TracedExpr: constant expression has no ciphertext");
+        std::vector<const TracedCiphertext<Backend>*> scaled;    // 정수가 아닌 가중치
+        std::vector<double> weights;
+        std::optional<TracedCiphertext<Backend>> positive, negative;   // 양수 가중치 항의 합, 음수 가중치 항의 |합|
+        for (const Term& term : linear.terms) {
+            const TracedCiphertext<Backend>& atom = lowerAtom(*term.atom, memo);
+            if (!isSmallInteger(term.weight)) {
+                scaled.push_back(&atom);
+                weights.push_back(term.weight);
+                continue;
+            }
+            const uint64_t n = static_cast<uint64_t>(std::fabs(term.weight));
+            TracedCiphertext<Backend> value = n == 1 ? atom : multiplyByAddition(atom, n);
+            accumulate(term.weight > 0 ? positive : negative, std::move(value));
+        }
+
+        double constant = linear.constant;
+        if (scaled.size() > 1) {   // 상수도 linearWSum 노드에 합침
+            accumulate(positive, TracedCiphertext<Backend>::cipherLinearWSum(scaled, weights, constant));
+            constant = 0;
+        }
+        else if (scaled.size() == 1) {
+            accumulate(positive, scaled[0]->cipherMult(weights[0]));
+        }
+
+        TracedCiphertext<Backend> result = positive ? (negative ? positive->cipherSub(*negative) : std::move(*positive))
+                                                    : negative->cipherNegate();
+        if (constant != 0)
+            result += constant;
+        return result;
+    }
+
+public:
+    TracedExpr(const TracedCiphertext<Backend>& ciphertext) {    // NOLINT: 암호문을 식에 바로 쓸 수 있도록 암묵적 변환
+        auto atom  = std::make_shared<Atom>();
+        atom->leaf = std::make_shared<const TracedCiphertext<Backend>>(ciphertext);
+        Linear leaf;
+        leaf.terms.push_back({std::move(atom), 1});
+        linear = std::make_shared<const Linear>(std::move(leaf));
+    }
+
+    TracedExpr(double constant) {    // NOLINT
+        Linear value;
+        value.constant = constant;
+        linear         = std::make_shared<const Linear>(std::move(value));
+    }
+
+    bool isConstant() const {
+        return linear->terms.empty();
+    }
+
+    // lowering 후 남는 항 수 (상수 제외)
+    size_t getTermCount() const {
+        return linear->terms.size();
+    }
+
+    TracedCiphertext<Backend> evaluate() const {
+        Memo memo;
+        return lower(linear, memo);
+    }
+
+    // 여러 출력을 같이 lowering: 출력 사이에 공유되는 부분식도 한 번만 계산
+    static std::vector<TracedCiphertext<Backend>> evaluate(const std::vector<TracedExpr>& outputs) {
+        Memo memo;
+        std::vector<TracedCiphertext<Backend>> results;
+        results.reserve(outputs.size());
+        for (const TracedExpr& output : outputs)
+            results.push_back(lower(output.linear, memo));
+        return results;
+    }
+
+    friend TracedExpr operator+(const TracedExpr& a, const TracedExpr& b) {
+        return TracedExpr(add(*a.linear, *b.linear));
+    }
+
+    friend TracedExpr operator-(const TracedExpr& a) {
+        return TracedExpr(scale(*a.linear, -1));
+    }
+
+    friend TracedExpr operator-(const TracedExpr& a, const TracedExpr& b) {
+        return TracedExpr(add(*a.linear, scale(*b.linear, -1)));
+    }
+
+    friend TracedExpr operator*(const TracedExpr& a, const TracedExpr& b) {
+        return TracedExpr(mult(a.linear, b.linear));
+    }
+};
+
+// 예) auto x = lazy(tc); auto t = x + 1; auto y = (t * t * (x * x + 2)).evaluate();
+//     t는 한 번만 계산되고 t * t, x * x는 같은 암호문끼리의 곱이라 cipherSquare. (x + 1) * (x + 1)로 쓰면 x + 1을 두 번 계산하고 cipherMult
+template <typename Backend>
+TracedExpr<Backend> lazy(const TracedCiphertext<Backend>& ciphertext) {
+    return TracedExpr<Backend>(ciphertext);
+}
+
+}  // namespace lbcrypto
+
+#endif
@@ -0,0 +1,195 @@
+//==================================================================================
+// BSD 2-Clause License
+//
+// Copyright (c) 2014-2022, NJIT, Duality Technologies Inc. and other contributors
+//
+// All rights reserved.
+//
+// Author TPOC: contact@openfhe.org
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// 1. Redistributions of source code must retain the above copyright notice, this
+//    list of conditions and the following disclaimer.
+//
+// 2. Redistributions in binary form must reproduce the above copyright notice,
+//    this list of conditions and the following disclaimer in the documentation
+//    and/or other materials provided with the distribution.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+// DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE
+// FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL
+// DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR
+// SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER
+// CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY,
+// OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//==================================================================================
+
+/*
+  Work-stealing thread pool
+  각 worker가 자기 deque 앞에서 작업을 꺼내고, 비면 다른 worker deque 뒤에서 훔쳐 옴
+ */
+
+#ifndef LBCRYPTO_TRACE_WORK_STEALING_POOL_H
+#define LBCRYPTO_TRACE_WORK_STEALING_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace lbcrypto {
+
+class WorkStealingPool {
+public:
+    using Task = std::function<void(size_t worker)>;
+
+private:
+    struct Worker {
+        std::deque<Task> tasks;
+        std::mutex mtx;
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers;
+    std::vector<std::thread> threads;
+    std::mutex mtx;
+    std::condition_variable cv;
+    std::atomic<size_t> queued{0};
+    std::atomic<size_t> steals{0};
+    std::atomic<size_t> nextWorker{0};
+    bool stopping = false;
+
+    bool popLocal(size_t id, Task& task) {
+        Worker& w = *workers[id];
+        std::lock_guard<std::mutex> lock(w.mtx);
+        if (w.tasks.empty())
+            return false;
+        task = std::move(w.tasks.front());
+        w.tasks.pop_front();
+        return true;
+    }
+
+    bool steal(size_t id, Task& task) {
+        for (size_t i = 1; i < workers.size(); ++i) {
+            Worker& victim = *workers[(id + i) % workers.size()];
+            std::lock_guard<std::mutex> lock(victim.mtx);
+            if (victim.tasks.empty())
+                continue;
+            task = std::move(victim.tasks.back());
+            victim.tasks.pop_back();
+            steals++;
+            return true;
+        }
+        return false;
+    }
+
+    void workerLoop(size_t id) {
+        while (true) {
+            Task task;
+            if (popLocal(id, task) || steal(id, task)) {
+                queued--;
+                task(id);
+                continue;
+            }
+            std::unique_lock<std::mutex> lock(mtx);
+            cv.wait(lock, [this] { return stopping || queued > 0; });
+            if (stopping && queued == 0)
+                return;
+        }
+    }
+
+public:
+    explicit WorkStealingPool(size_t numThreads = std::thread::hardware_concurrency()) {
+        numThreads = std::max<size_t>(numThreads, 1);
+        for (size_t i = 0; i < numThreads; ++i)
+            workers.push_back(std::make_unique<Worker>());
+        for (size_t i = 0; i < numThreads; ++i)
+            threads.emplace_back([this, i] { workerLoop(i); });
+    }
+
+    ~WorkStealingPool() {
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            stopping = true;
+        }
+        cv.notify_all();
+        for (auto& t : threads)
+            t.join();
+    }
+
+    WorkStealingPool(const WorkStealingPool&)            = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    size_t size() const {
+        return workers.size();
+    }
+
+    size_t getStealCount() const {
+        return steals;
+    }
+
+    // 작업을 worker deque에 돌아가며 넣음. 실행 worker 번호를 인자로 받음
+    void submit(Task task) {
+        Worker& w = *workers[nextWorker++ % workers.size()];
+        {
+            std::lock_guard<std::mutex> lock(w.mtx);
+            w.tasks.push_back(std::move(task));
+        }
+        {
+            std::lock_guard<std::mutex> lock(mtx);
+            queued++;
+        }
+        cv.notify_one();
+    }
+
+    // [0, count)를 grain 크기 chunk로 나눠 fn(begin, end, worker) 실행. 모든 chunk가 끝나면 반환하고,
+    // chunk에서 던진 첫 예외를 다시 던짐. worker 스레드 안에서 호출하면 안 됨 (deadlock)
+    void parallelFor(size_t count, size_t grain, const std::function<void(size_t, size_t, size_t)>& fn) {
+        if (count == 0)
+            return;
+        grain = std::max<size_t>(grain, 1);
+        struct Batch {
+            size_t remaining;
+            std::exception_ptr error;
+            std::mutex mtx;
+            std::condition_variable done;
+        } batch;
+        batch.remaining = (count + grain - 1) / grain;
+
+        for (size_t begin = 0; begin < count; begin += grain) {
+            size_t end = std::min(count, begin + grain);
+            submit([&batch, &fn, begin, end](size_t worker) {
+                std::exception_ptr error;
+                try {
+                    fn(begin, end, worker);
+                }
+                catch (...) {
+                    error = std::current_exception();
+                }
+                std::lock_guard<std::mutex> lock(batch.mtx);
+                if (error && !batch.error)
+                    batch.error = error;
+                if (--batch.remaining == 0)
+                    batch.done.notify_all();
+            });
+        }
+        std::unique_lock<std::mutex> lock(batch.mtx);
+        batch.done.wait(lock, [&batch] { return batch.remaining == 0; });
+        if (batch.error)
+            std::rethrow_exception(batch.error);
+    }
+};
+
+}  // namespace lbcrypto
+
+#endif